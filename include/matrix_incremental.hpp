@@ -0,0 +1,51 @@
+#ifndef MATRIX_INCREMENTAL_HPP
+#define MATRIX_INCREMENTAL_HPP
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Operands and result of a previous run, kept to update C incrementally in the next one.
+ */
+struct ProductState {
+  int rowsA = 0;
+  int colsA = 0;
+  int colsB = 0;
+  std::vector<std::vector<int>> A, B, C;
+};
+
+/**
+ * @brief Writes the state in binary form: the "MMST" magic, the three sizes, then A, B and C as
+ * row-major 32-bit integers.
+ * @return false if the file cannot be written.
+ */
+bool saveProductState(const std::string &filename, const ProductState &state);
+
+/**
+ * @brief Reads a state written by saveProductState.
+ * @note The sizes in the header are checked against the length of the file before anything is allocated.
+ * @return false if the file is missing, truncated, damaged or not a product state.
+ */
+bool loadProductState(const std::string &filename, ProductState &state);
+
+/**
+ * @brief Computes C = A * B from the previous product instead of from scratch.
+ *
+ * The new operands are diffed against the previous ones and only the affected entries of C are
+ * updated, using C = C_prev + (A - A_prev) * B + A_prev * (B - B_prev):
+ * every changed entry A[i][k] is a rank-1 update of row i of C, every changed entry B[k][j] a rank-1
+ * update of column j of C. Edited rows of A and columns of B therefore cost O(n^2) each.
+ *
+ * @note Arithmetic wraps modulo 2^32, so the result matches the one of a full int multiplication.
+ * @param maxWorkFraction the update is only applied if its multiply-adds are at most this fraction
+ * of the ones of a full multiplication.
+ * @return true if C was updated, false if the sizes differ or the change is too large, in which case
+ * C is left untouched and a full multiplication is needed.
+ */
+bool updateProductIncremental(const ProductState &previous,
+                              const std::vector<std::vector<int>> &A,
+                              const std::vector<std::vector<int>> &B,
+                              std::vector<std::vector<int>> &C, int rowsA, int colsA,
+                              int colsB, double maxWorkFraction = 0.25);
+
+#endif // MATRIX_INCREMENTAL_HPP
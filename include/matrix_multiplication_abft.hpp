@@ -0,0 +1,75 @@
+#ifndef MATRIX_MULTIPLICATION_ABFT_HPP
+#define MATRIX_MULTIPLICATION_ABFT_HPP
+
+#include "matrix_multiplication.h"
+#include <functional>
+#include <mpi.h>
+#include <vector>
+
+/**
+ * @brief Any multiplication backend sharing the signature of multiplyMatrices.
+ */
+using MultiplyKernel = std::function<void(const std::vector<std::vector<int>> &,
+                                          const std::vector<std::vector<int>> &,
+                                          std::vector<std::vector<int>> &, int, int, int)>;
+
+/**
+ * @brief Outcome of the checksum verification of a product.
+ * @note mismatchedRows/mismatchedCols count the rows and columns of C whose checksum does not match.
+ * @note faultyRow/faultyCol locate the corrected entry, they are -1 when no entry was corrected.
+ */
+struct AbftReport {
+  bool errorDetected = false;
+  bool errorCorrected = false;
+  int mismatchedRows = 0;
+  int mismatchedCols = 0;
+  int faultyRow = -1;
+  int faultyCol = -1;
+};
+
+/**
+ * @brief Builds the checksum-augmented operands: Ac is A with an extra row holding its column sums,
+ * Bc is B with an extra column holding its row sums. Their product is C bordered by its own
+ * column-sum row and row-sum column.
+ * @note Sums wrap around modulo 2^32, consistently with the int arithmetic of the kernels.
+ */
+void encodeChecksums(const std::vector<std::vector<int>> &A,
+                     const std::vector<std::vector<int>> &B,
+                     std::vector<std::vector<int>> &Ac,
+                     std::vector<std::vector<int>> &Bc, int rowsA, int colsA,
+                     int colsB);
+
+/**
+ * @brief Verifies the checksums of the augmented product Cc in O(rowsA * colsB), corrects a single
+ * faulty entry and copies the rowsA x colsB result into C.
+ * @note A single wrong entry of the checksum row, of the checksum column or of their corner leaves the
+ * result intact and is reported as detected and corrected; the corner entry is used to cross-check it.
+ * Any other pattern, e.g. two faults cancelling out within a row, is reported as detected but not corrected.
+ */
+AbftReport verifyChecksums(const std::vector<std::vector<int>> &Cc,
+                           std::vector<std::vector<int>> &C, int rowsA, int colsB);
+
+/**
+ * @brief Algorithm-based fault tolerant multiplication: runs kernel once on the checksum-augmented
+ * operands and verifies the result, at the cost of one extra row and column instead of a second product.
+ * @note The default kernel is the library multiplyMatrices.
+ */
+AbftReport multiplyMatricesABFT(const std::vector<std::vector<int>> &A,
+                                const std::vector<std::vector<int>> &B,
+                                std::vector<std::vector<int>> &C, int rowsA,
+                                int colsA, int colsB,
+                                const MultiplyKernel &kernel = multiplyMatrices);
+
+/**
+ * @brief Algorithm-based fault tolerant version of multiplyMatricesDistributed: the checksum-augmented
+ * product runs distributed over comm, rank 0 encodes the operands and verifies the result.
+ * @note Collective over comm: every rank calls it with the same sizes, so the ranks always join the
+ * distributed product with the augmented shape used by the root.
+ * @note A and B are only read, and C and the report only filled, on rank 0 of comm.
+ */
+AbftReport multiplyMatricesABFTDistributed(const std::vector<std::vector<int>> &A,
+                                           const std::vector<std::vector<int>> &B,
+                                           std::vector<std::vector<int>> &C, int rowsA,
+                                           int colsA, int colsB, MPI_Comm comm);
+
+#endif // MATRIX_MULTIPLICATION_ABFT_HPP
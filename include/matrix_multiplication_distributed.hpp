@@ -0,0 +1,44 @@
+#ifndef MATRIX_MULTIPLICATION_DISTRIBUTED_HPP
+#define MATRIX_MULTIPLICATION_DISTRIBUTED_HPP
+
+#include "matrix_tuning.hpp"
+#include <mpi.h>
+#include <vector>
+
+/**
+ * @brief Topology-aware distributed matrix multiplication C = A * B.
+ *
+ * The communicator is split into node-local groups (MPI_COMM_TYPE_SHARED) and an inter-node group
+ * made of one leader per node. Processes are laid out on a 2D grid (nodes x ranks per node):
+ * - every node owns a band of rows of A and C, scattered from the root among the node leaders only;
+ * - B is broadcast once per node among the leaders;
+ * - within a node, A, B and the C band live in MPI-3 shared-memory windows (MPI_Win_allocate_shared),
+ *   so they are stored once per node and never copied between local ranks;
+ * - the local ranks form a grid of their own and each computes a block of the node band reading A and B
+ *   directly from the shared windows, so the heaviest panel exchanges stay on-node.
+ *
+ * Local kernel, tile sizes, threads per rank and shape of the local grid come from the tuning table
+ * (see tuningTable and autotune).
+ *
+ * @note Products with a compile-time specialization (see multiplyMatricesFixed) are computed on rank 0 alone.
+ * @note A and B are only read on rank 0 of comm; rowsA, colsA and colsB must be valid on every rank.
+ * @note C is only filled on rank 0 of comm, the other ranks leave it untouched.
+ * @note The function is collective over comm.
+ */
+void multiplyMatricesDistributed(const std::vector<std::vector<int>> &A,
+                                 const std::vector<std::vector<int>> &B,
+                                 std::vector<std::vector<int>> &C, int rowsA,
+                                 int colsA, int colsB,
+                                 MPI_Comm comm = MPI_COMM_WORLD);
+
+/**
+ * @brief Same as above with explicit tuning parameters instead of the ones from the tuning table.
+ * @note The parameters of rank 0 are used on every rank.
+ */
+void multiplyMatricesDistributed(const std::vector<std::vector<int>> &A,
+                                 const std::vector<std::vector<int>> &B,
+                                 std::vector<std::vector<int>> &C, int rowsA,
+                                 int colsA, int colsB, MPI_Comm comm,
+                                 const TuningParameters &tuning);
+
+#endif // MATRIX_MULTIPLICATION_DISTRIBUTED_HPP
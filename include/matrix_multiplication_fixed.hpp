@@ -0,0 +1,74 @@
+#ifndef MATRIX_MULTIPLICATION_FIXED_HPP
+#define MATRIX_MULTIPLICATION_FIXED_HPP
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Stack-allocated M x N matrix whose sizes are known at compile time.
+ */
+template <std::size_t M, std::size_t N>
+using FixedMatrix = std::array<std::array<int, N>, M>;
+
+namespace fixed_detail {
+
+template <std::size_t M, std::size_t K, std::size_t N, std::size_t... Ks>
+constexpr int dot(const FixedMatrix<M, K> &A, const FixedMatrix<K, N> &B,
+                  std::size_t i, std::size_t j, std::index_sequence<Ks...>) {
+  return (0 + ... + (A[i][Ks] * B[Ks][j]));
+}
+
+template <std::size_t M, std::size_t K, std::size_t N, std::size_t... IJ>
+constexpr void multiplyEntries(const FixedMatrix<M, K> &A, const FixedMatrix<K, N> &B,
+                               FixedMatrix<M, N> &C, std::index_sequence<IJ...>) {
+  ((C[IJ / N][IJ % N] = dot<M, K, N>(A, B, IJ / N, IJ % N, std::make_index_sequence<K>{})), ...);
+}
+
+} // namespace fixed_detail
+
+/**
+ * @brief Compile-time sized multiplication C = A * B. Both the M * N entries and the K terms of every
+ * entry are expanded at compile time, so the product is fully unrolled and lives on the stack.
+ * @note The function is constexpr, products of constant matrices can be evaluated at compile time.
+ */
+template <std::size_t M, std::size_t K, std::size_t N>
+constexpr FixedMatrix<M, N> multiply(const FixedMatrix<M, K> &A, const FixedMatrix<K, N> &B) {
+  FixedMatrix<M, N> C{};
+  fixed_detail::multiplyEntries<M, K, N>(A, B, C, std::make_index_sequence<M * N>{});
+  return C;
+}
+
+/**
+ * @brief Every shape with all sizes up to this bound has a specialization.
+ */
+constexpr int maxFixedShapeSize = 4;
+
+/**
+ * @brief Square shapes up to this bound have a specialization.
+ */
+constexpr int maxFixedSquareSize = 16;
+
+/**
+ * @brief Whether multiplyMatricesFixed has a specialization for the given runtime sizes.
+ */
+constexpr bool hasFixedSpecialization(int rowsA, int colsA, int colsB) {
+  return rowsA >= 1 && colsA >= 1 && colsB >= 1 &&
+         ((rowsA <= maxFixedShapeSize && colsA <= maxFixedShapeSize && colsB <= maxFixedShapeSize) ||
+          (rowsA == colsA && colsA == colsB && rowsA <= maxFixedSquareSize));
+}
+
+/**
+ * @brief Runtime dispatcher: routes the product to the multiply<M,K,N> specialization matching the
+ * runtime sizes, if there is one.
+ * @note Specializations exist for every shape with sizes up to maxFixedShapeSize and for square
+ * shapes up to maxFixedSquareSize, which keeps the number of instantiations reasonable.
+ * @return true if a specialization handled the product, false if C was left untouched.
+ */
+bool multiplyMatricesFixed(const std::vector<std::vector<int>> &A,
+                           const std::vector<std::vector<int>> &B,
+                           std::vector<std::vector<int>> &C, int rowsA, int colsA,
+                           int colsB);
+
+#endif // MATRIX_MULTIPLICATION_FIXED_HPP
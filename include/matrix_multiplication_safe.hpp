@@ -0,0 +1,46 @@
+#ifndef MATRIX_MULTIPLICATION_SAFE_HPP
+#define MATRIX_MULTIPLICATION_SAFE_HPP
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file matrix_multiplication_safe.hpp
+ * @brief Overflow-safe variants of the multiplication. They accumulate in int64 and check for overflow
+ * inside the kernel itself: the int64 accumulation is checked in the inner loop only when the magnitude
+ * of the inputs makes an int64 overflow possible, and the range of the result is checked when each
+ * entry is stored. No separate pass over C is needed.
+ * @note Entries whose int64 accumulation overflows are recomputed exactly with 128-bit arithmetic, so
+ * the results below are exact for any int input.
+ */
+
+/**
+ * @brief Widened multiplication: C holds int64 results.
+ * @return the number of entries that do not fit in int64, which are saturated to the int64 range.
+ */
+int multiplyMatricesWidened(const std::vector<std::vector<int>> &A,
+                            const std::vector<std::vector<int>> &B,
+                            std::vector<std::vector<int64_t>> &C, int rowsA,
+                            int colsA, int colsB);
+
+/**
+ * @brief Saturating multiplication: entries that do not fit in int are clamped to INT_MIN or INT_MAX.
+ * @return the number of saturated entries.
+ */
+int multiplyMatricesSaturating(const std::vector<std::vector<int>> &A,
+                               const std::vector<std::vector<int>> &B,
+                               std::vector<std::vector<int>> &C, int rowsA,
+                               int colsA, int colsB);
+
+/**
+ * @brief Flagging multiplication: overflowed[i][j] tells whether the exact C[i][j] does not fit in int.
+ * Flagged entries hold the exact result wrapped modulo 2^32, as the plain int product would.
+ * @return the number of flagged entries.
+ */
+int multiplyMatricesFlagged(const std::vector<std::vector<int>> &A,
+                            const std::vector<std::vector<int>> &B,
+                            std::vector<std::vector<int>> &C,
+                            std::vector<std::vector<bool>> &overflowed, int rowsA,
+                            int colsA, int colsB);
+
+#endif // MATRIX_MULTIPLICATION_SAFE_HPP
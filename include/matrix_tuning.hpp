@@ -0,0 +1,71 @@
+#ifndef MATRIX_TUNING_HPP
+#define MATRIX_TUNING_HPP
+
+#include <mpi.h>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Local kernel used by each rank of the distributed multiplication on its block of C.
+ */
+enum class PanelKernel { Naive, Blocked };
+
+/**
+ * @brief Parameters of the distributed multiplication for one class of shapes.
+ * @note An entry applies to the products whose largest size is at most maxSize.
+ * @note gridRows is the number of rows of the grid of local ranks inside a node, the local ranks are
+ * laid out as gridRows x (ranks per node / gridRows). It is ignored if it does not divide the ranks per node.
+ */
+struct TuningParameters {
+  int maxSize = 0;
+  PanelKernel kernel = PanelKernel::Blocked;
+  int tileRows = 32;
+  int tileInner = 128;
+  int tileCols = 256;
+  int threads = 1;
+  int gridRows = 1;
+};
+
+/**
+ * @brief Reads a tuning file. Each non-comment line holds, in order:
+ * maxSize kernel(naive|blocked) tileRows tileInner tileCols threads gridRows
+ * @note A missing file yields an empty table. Malformed lines are skipped, including unknown kernels and
+ * non-positive tile sizes, threads or grid rows.
+ */
+std::vector<TuningParameters> loadTuningFile(const std::string &filename);
+
+/**
+ * @brief Writes a tuning table in the format read by loadTuningFile.
+ * @return false if the file cannot be written.
+ */
+bool saveTuningFile(const std::string &filename, const std::vector<TuningParameters> &table);
+
+/**
+ * @brief Picks the entry of the smallest shape class containing the product, or the largest class if
+ * the product is bigger than all of them. An empty table yields the default parameters.
+ */
+TuningParameters selectTuning(const std::vector<TuningParameters> &table, int rowsA, int colsA, int colsB);
+
+/**
+ * @brief Tuning table used by the library. It is loaded on first use from the file named by the
+ * MM_TUNING_FILE environment variable, or from "tuning.txt" in the working directory.
+ */
+const std::vector<TuningParameters> &tuningTable();
+
+/**
+ * @brief Replaces the tuning table used by the library, e.g. with one loaded from a custom path
+ * or produced by autotune.
+ */
+void setTuningTable(const std::vector<TuningParameters> &table);
+
+/**
+ * @brief Benchmarks candidate configurations of the distributed multiplication on square products of
+ * the given representative sizes and returns the fastest one for each size.
+ *
+ * The search is a coordinate descent: kernel and tile sizes are chosen first with one thread on a
+ * flat local grid, then the thread count, then the shape of the local grid.
+ * @note The function is collective over comm, the table is only meaningful on rank 0.
+ */
+std::vector<TuningParameters> autotune(const std::vector<int> &sizes, MPI_Comm comm = MPI_COMM_WORLD);
+
+#endif // MATRIX_TUNING_HPP
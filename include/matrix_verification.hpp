@@ -0,0 +1,35 @@
+#ifndef MATRIX_VERIFICATION_HPP
+#define MATRIX_VERIFICATION_HPP
+
+#include <mpi.h>
+#include <vector>
+
+/**
+ * @brief Freivalds' probabilistic check of C == A * B in O(iterations * n^2).
+ *
+ * For each iteration a random vector r with entries in {0, 1} is drawn and A * (B * r) is compared
+ * with C * r. A correct product always passes, a wrong one passes a single iteration with probability
+ * at most 1/2, so the probability of accepting a wrong product is at most 2^-iterations.
+ * @note Arithmetic wraps modulo 2^32, consistently with the int arithmetic of the kernels.
+ * @return true if every iteration agrees.
+ */
+bool verifyProductFreivalds(const std::vector<std::vector<int>> &A,
+                            const std::vector<std::vector<int>> &B,
+                            const std::vector<std::vector<int>> &C, int rowsA,
+                            int colsA, int colsB, int iterations, unsigned seed);
+
+/**
+ * @brief Distributed Freivalds' check: the iterations are split among the ranks of comm.
+ * @note A, B and C are only read on rank 0 of comm and are broadcast to the other ranks, which costs
+ * O(n^2) communication, the same order as the check itself. The sizes, iterations and seed must be
+ * valid on every rank.
+ * @note The function is collective over comm and returns the same verdict on every rank.
+ */
+bool verifyProductFreivaldsDistributed(const std::vector<std::vector<int>> &A,
+                                       const std::vector<std::vector<int>> &B,
+                                       const std::vector<std::vector<int>> &C,
+                                       int rowsA, int colsA, int colsB,
+                                       int iterations, unsigned seed,
+                                       MPI_Comm comm = MPI_COMM_WORLD);
+
+#endif // MATRIX_VERIFICATION_HPP
@@ -1,7 +1,17 @@
-#include "matrix_multiplication.h"
+#include "matrix_incremental.hpp"
+#include "matrix_multiplication_abft.hpp"
+#include "matrix_multiplication_distributed.hpp"
+#include "matrix_multiplication_safe.hpp"
+#include "matrix_tuning.hpp"
+#include "matrix_verification.hpp"
 #include <mpi.h>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <random>
+#include <string>
 #include <vector>
 
 void readMatrixFromFile(const std::string& filename, std::vector<std::vector<int>>& matrix, int& rows, int& cols) {
@@ -36,6 +46,80 @@ int main(int argc, char** argv) {
         return -1;
     }
 
+    // --abft: verify (and correct) the product through checksums instead of trusting it blindly.
+    // --verify[=N]: check the product with N random vectors (Freivalds), 10 by default.
+    // A product rejected by either check is not printed and the exit status is 1.
+    // --tuning=FILE: load the tuning table from FILE instead of $MM_TUNING_FILE or tuning.txt.
+    // --autotune[=FILE]: benchmark this machine first and store the winners in FILE, tuning.txt by default.
+    // --incremental[=FILE]: update the product stored in FILE, product_state.bin by default, and store the new one.
+    // An incrementally updated C has no checksums: with --abft it is checked with Freivalds instead.
+    // --overflow=saturate|flag|widen: compute the exact product on the root and clamp, flag or widen to
+    // 64 bits the entries that do not fit in int. The checks above assume wrapped int products and are ignored.
+    bool abft = false;
+    int verifyIterations = 0;
+    std::string tuningFile;
+    std::string autotuneFile;
+    std::string incrementalFile;
+    std::string overflowMode;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        if (arg == "--abft") {
+            abft = true;
+        } else if (arg == "--verify") {
+            verifyIterations = 10;
+        } else if (arg.rfind("--verify=", 0) == 0) {
+            char* end = nullptr;
+            long iterations = std::strtol(arg.c_str() + 9, &end, 10);
+            if (end != arg.c_str() + 9 && *end == '\0' && iterations > 0 && iterations <= INT_MAX) {
+                verifyIterations = static_cast<int>(iterations);
+            } else if (rank == 0) {
+                std::cerr << "Ignoring invalid option: " << arg << " (expected a positive number of random vectors)" << std::endl;
+            }
+        } else if (arg.rfind("--tuning=", 0) == 0) {
+            tuningFile = arg.substr(9);
+        } else if (arg == "--autotune") {
+            autotuneFile = "tuning.txt";
+        } else if (arg.rfind("--autotune=", 0) == 0) {
+            autotuneFile = arg.substr(11);
+        } else if (arg == "--incremental") {
+            incrementalFile = "product_state.bin";
+        } else if (arg.rfind("--incremental=", 0) == 0) {
+            incrementalFile = arg.substr(14);
+        } else if (arg == "--overflow=saturate" || arg == "--overflow=flag" || arg == "--overflow=widen") {
+            overflowMode = arg.substr(11);
+        } else if (arg.rfind("--overflow=", 0) == 0) {
+            if (rank == 0) {
+                std::cerr << "Ignoring invalid option: " << arg << " (expected saturate, flag or widen)" << std::endl;
+            }
+        } else if (rank == 0) {
+            std::cerr << "Ignoring unknown option: " << arg << std::endl;
+        }
+    }
+
+    if (!overflowMode.empty() && (abft || verifyIterations > 0 || !incrementalFile.empty())) {
+        if (rank == 0) {
+            std::cerr << "Ignoring --abft, --verify and --incremental with --overflow=" << overflowMode << std::endl;
+        }
+        abft = false;
+        verifyIterations = 0;
+        incrementalFile.clear();
+    }
+
+    if (!tuningFile.empty()) {
+        setTuningTable(loadTuningFile(tuningFile));
+    }
+    if (!autotuneFile.empty()) {
+        std::vector<TuningParameters> table = autotune({64, 256, 768}, MPI_COMM_WORLD);
+        if (rank == 0) {
+            setTuningTable(table);
+            if (saveTuningFile(autotuneFile, table)) {
+                std::cerr << "Autotuning: parameters stored in " << autotuneFile << std::endl;
+            } else {
+                std::cerr << "Error writing tuning file: " << autotuneFile << std::endl;
+            }
+        }
+    }
+
     int rowsA, colsA, rowsB, colsB;
     std::vector<std::vector<int>> A, B;
 
@@ -50,32 +134,155 @@ int main(int argc, char** argv) {
     MPI_Bcast(&rowsB, 1, MPI_INT, 0, MPI_COMM_WORLD);
     MPI_Bcast(&colsB, 1, MPI_INT, 0, MPI_COMM_WORLD);
 
-    
-    if (rank != 0) {
-        A.resize(rowsA, std::vector<int>(colsA));
+    // A and B stay on rank 0: the distributed multiply ships them once per node and shares them
+    // among the local ranks through shared-memory windows.
+    std::vector<std::vector<int>> C;
+    if (rank == 0) {
+        C.assign(rowsA, std::vector<int>(colsB, 0));
     }
-    for (int i = 0; i < rowsA; ++i) {
-        MPI_Bcast(A[i].data(), colsA, MPI_INT, 0, MPI_COMM_WORLD);
+
+    // Incremental mode: when only a few rows of A or columns of B changed since the stored run, C is
+    // updated on the root and the full multiplication is skipped on every rank.
+    int updated = 0;
+    bool productRejected = false;
+    if (!incrementalFile.empty()) {
+        if (rank == 0) {
+            ProductState previous;
+            if (loadProductState(incrementalFile, previous) &&
+                updateProductIncremental(previous, A, B, C, rowsA, colsA, colsB)) {
+                updated = 1;
+                std::cerr << "Incremental: C updated from " << incrementalFile << std::endl;
+            } else {
+                std::cerr << "Incremental: no usable previous product, full multiplication." << std::endl;
+            }
+        }
+        MPI_Bcast(&updated, 1, MPI_INT, 0, MPI_COMM_WORLD);
     }
 
-    
-    if (rank != 0) {
-        B.resize(rowsB, std::vector<int>(colsB));
+    std::vector<std::vector<int64_t>> wideC;
+    if (updated) {
+        // C is already up to date. ABFT needs the augmented product, so the updated C is checked with
+        // Freivalds instead (every rank knows updated, so they all agree on the check).
+        if (abft && verifyIterations == 0) {
+            verifyIterations = 10;
+        }
+        if (abft && rank == 0) {
+            std::cerr << "ABFT: not applied to an incrementally updated C, checking it with Freivalds instead." << std::endl;
+        }
+    } else if (!overflowMode.empty()) {
+        // The overflow-safe kernels run on the root only.
+        if (rank == 0 && overflowMode == "saturate") {
+            int overflows = multiplyMatricesSaturating(A, B, C, rowsA, colsA, colsB);
+            if (overflows > 0) {
+                std::cerr << "Overflow: " << overflows << " entries saturated to the int range!" << std::endl;
+            } else {
+                std::cerr << "Overflow: no entry overflowed int." << std::endl;
+            }
+        } else if (rank == 0 && overflowMode == "flag") {
+            std::vector<std::vector<bool>> overflowed;
+            int overflows = multiplyMatricesFlagged(A, B, C, overflowed, rowsA, colsA, colsB);
+            if (overflows > 0) {
+                std::cerr << "Overflow: " << overflows << " entries overflowed int and hold wrapped values:";
+                for (int i = 0; i < rowsA; ++i) {
+                    for (int j = 0; j < colsB; ++j) {
+                        if (overflowed[i][j]) {
+                            std::cerr << " C[" << i << "][" << j << "]";
+                        }
+                    }
+                }
+                std::cerr << std::endl;
+            } else {
+                std::cerr << "Overflow: no entry overflowed int." << std::endl;
+            }
+        } else if (rank == 0) {
+            wideC.assign(rowsA, std::vector<int64_t>(colsB, 0));
+            int saturated = multiplyMatricesWidened(A, B, wideC, rowsA, colsA, colsB);
+            int beyondInt = 0;
+            for (const auto& row : wideC) {
+                for (int64_t elem : row) {
+                    beyondInt += elem < INT_MIN || elem > INT_MAX;
+                }
+            }
+            std::cerr << "Overflow: " << beyondInt << " entries exceed int, C is printed in 64 bits." << std::endl;
+            if (saturated > 0) {
+                std::cerr << "Overflow: " << saturated << " entries saturated to the int64 range!" << std::endl;
+            }
+        }
+    } else if (!abft) {
+        multiplyMatricesDistributed(A, B, C, rowsA, colsA, colsB, MPI_COMM_WORLD);
+    } else {
+        // Collective: the checksum-augmented product runs distributed, only the root encodes and verifies.
+        AbftReport report = multiplyMatricesABFTDistributed(A, B, C, rowsA, colsA, colsB, MPI_COMM_WORLD);
+        if (rank != 0) {
+            // Only the root holds the report.
+        } else if (!report.errorDetected) {
+            std::cerr << "ABFT: checksums verified, no error detected." << std::endl;
+        } else if (report.errorCorrected) {
+            std::cerr << "ABFT: error detected and corrected";
+            if (report.faultyRow >= 0) {
+                std::cerr << " at C[" << report.faultyRow << "][" << report.faultyCol << "]";
+            }
+            std::cerr << "." << std::endl;
+        } else {
+            productRejected = true;
+            std::cerr << "ABFT: uncorrectable error detected (" << report.mismatchedRows << " rows, "
+                      << report.mismatchedCols << " columns mismatched)!" << std::endl;
+        }
     }
-    for (int i = 0; i < rowsB; ++i) {
-        MPI_Bcast(B[i].data(), colsB, MPI_INT, 0, MPI_COMM_WORLD);
+
+    if (verifyIterations > 0) {
+        unsigned seed = 0;
+        if (rank == 0) {
+            seed = std::random_device{}();
+        }
+        MPI_Bcast(&seed, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
+        bool verified = verifyProductFreivaldsDistributed(A, B, C, rowsA, colsA, colsB, verifyIterations, seed, MPI_COMM_WORLD);
+        if (rank == 0) {
+            if (verified) {
+                std::cerr << "Freivalds: product verified with " << verifyIterations << " random vectors." << std::endl;
+            } else {
+                productRejected = true;
+                std::cerr << "Freivalds: wrong product detected! Seed: " << seed << std::endl;
+            }
+        }
     }
 
-    std::vector<std::vector<int>> C(rowsA, std::vector<int>(colsB, 0));
-    multiplyMatrices(A, B, C, rowsA, colsA, colsB);
+    // A product that failed a check must never seed the next incremental run: drop the stored one instead.
+    if (!incrementalFile.empty() && rank == 0 && productRejected) {
+        std::remove(incrementalFile.c_str());
+        std::cerr << "Incremental: product rejected, " << incrementalFile << " discarded." << std::endl;
+    } else if (!incrementalFile.empty() && rank == 0) {
+        ProductState current{rowsA, colsA, colsB, A, B, C};
+        if (!saveProductState(incrementalFile, current)) {
+            std::cerr << "Error writing product state: " << incrementalFile << std::endl;
+        }
+    }
+
+    // The ABFT outcome is only known on the root: every rank has to agree on the exit status.
+    int rejected = productRejected ? 1 : 0;
+    MPI_Bcast(&rejected, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    if (rejected) {
+        if (rank == 0) {
+            std::cerr << "The product failed verification, C is not printed." << std::endl;
+        }
+        MPI_Finalize();
+        return 1;
+    }
 
     if (rank == 0) {
-        std::cout << "Congratulations, bro. Here is your resultant matrix C:" << std::endl;
-        for (const auto& row : C) {
-            for (const auto& elem : row) {
-                std::cout << elem << " ";
+        auto printMatrix = [](const auto& matrix) {
+            for (const auto& row : matrix) {
+                for (const auto& elem : row) {
+                    std::cout << elem << " ";
+                }
+                std::cout << std::endl;
             }
-            std::cout << std::endl;
+        };
+        std::cout << "Congratulations, bro. Here is your resultant matrix C:" << std::endl;
+        if (overflowMode == "widen") {
+            printMatrix(wideC);
+        } else {
+            printMatrix(C);
         }
     }
 
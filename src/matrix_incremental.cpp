@@ -0,0 +1,151 @@
+#include "matrix_incremental.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+
+namespace {
+
+const char stateMagic[4] = {'M', 'M', 'S', 'T'};
+
+struct Change {
+  int row;
+  int col;
+  unsigned delta;
+};
+
+void writeMatrix(std::ofstream &outfile, const std::vector<std::vector<int>> &M, int rows, int cols) {
+  std::vector<int32_t> row(cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      row[j] = M[i][j];
+    }
+    outfile.write(reinterpret_cast<const char *>(row.data()), static_cast<std::streamsize>(cols * sizeof(int32_t)));
+  }
+}
+
+bool readMatrix(std::ifstream &infile, std::vector<std::vector<int>> &M, int rows, int cols) {
+  M.assign(rows, std::vector<int>(cols));
+  std::vector<int32_t> row(cols);
+  for (int i = 0; i < rows; ++i) {
+    if (!infile.read(reinterpret_cast<char *>(row.data()), static_cast<std::streamsize>(cols * sizeof(int32_t)))) {
+      return false;
+    }
+    for (int j = 0; j < cols; ++j) {
+      M[i][j] = row[j];
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Lists the entries that differ between the new and the previous matrix. Differences wrap
+ * modulo 2^32 through unsigned arithmetic.
+ */
+std::vector<Change> diff(const std::vector<std::vector<int>> &current,
+                         const std::vector<std::vector<int>> &previous, int rows, int cols) {
+  std::vector<Change> changes;
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      if (current[i][j] != previous[i][j]) {
+        changes.push_back({i, j, static_cast<unsigned>(current[i][j]) - static_cast<unsigned>(previous[i][j])});
+      }
+    }
+  }
+  return changes;
+}
+
+} // namespace
+
+bool saveProductState(const std::string &filename, const ProductState &state) {
+  std::ofstream outfile(filename, std::ios::binary);
+  if (!outfile) {
+    return false;
+  }
+  int32_t sizes[3] = {state.rowsA, state.colsA, state.colsB};
+  outfile.write(stateMagic, sizeof(stateMagic));
+  outfile.write(reinterpret_cast<const char *>(sizes), sizeof(sizes));
+  writeMatrix(outfile, state.A, state.rowsA, state.colsA);
+  writeMatrix(outfile, state.B, state.colsA, state.colsB);
+  writeMatrix(outfile, state.C, state.rowsA, state.colsB);
+  return static_cast<bool>(outfile);
+}
+
+bool loadProductState(const std::string &filename, ProductState &state) {
+  std::ifstream infile(filename, std::ios::binary | std::ios::ate);
+  if (!infile) {
+    return false;
+  }
+  const long long fileBytes = static_cast<long long>(infile.tellg());
+  infile.seekg(0);
+
+  char magic[4];
+  int32_t sizes[3];
+  if (!infile.read(magic, sizeof(magic)) || !std::equal(magic, magic + 4, stateMagic) ||
+      !infile.read(reinterpret_cast<char *>(sizes), sizeof(sizes)) ||
+      sizes[0] < 0 || sizes[1] < 0 || sizes[2] < 0) {
+    return false;
+  }
+
+  // A damaged header must not drive the allocations: the sizes have to match the length of the file.
+  // The length is computed in uint64 with explicit overflow checks, so huge sizes cannot wrap onto it.
+  const uint64_t rowsA = sizes[0], colsA = sizes[1], colsB = sizes[2];
+  uint64_t entriesA, entriesB, entriesC, entries, payload, expectedBytes;
+  if (__builtin_mul_overflow(rowsA, colsA, &entriesA) || __builtin_mul_overflow(colsA, colsB, &entriesB) ||
+      __builtin_mul_overflow(rowsA, colsB, &entriesC) || __builtin_add_overflow(entriesA, entriesB, &entries) ||
+      __builtin_add_overflow(entries, entriesC, &entries) ||
+      __builtin_mul_overflow(entries, uint64_t(sizeof(int32_t)), &payload) ||
+      __builtin_add_overflow(payload, uint64_t(sizeof(stateMagic) + sizeof(sizes)), &expectedBytes) ||
+      fileBytes < 0 || expectedBytes != static_cast<uint64_t>(fileBytes)) {
+    return false;
+  }
+  state.rowsA = sizes[0];
+  state.colsA = sizes[1];
+  state.colsB = sizes[2];
+  return readMatrix(infile, state.A, state.rowsA, state.colsA) &&
+         readMatrix(infile, state.B, state.colsA, state.colsB) &&
+         readMatrix(infile, state.C, state.rowsA, state.colsB);
+}
+
+bool updateProductIncremental(const ProductState &previous,
+                              const std::vector<std::vector<int>> &A,
+                              const std::vector<std::vector<int>> &B,
+                              std::vector<std::vector<int>> &C, int rowsA, int colsA,
+                              int colsB, double maxWorkFraction) {
+  if (previous.rowsA != rowsA || previous.colsA != colsA || previous.colsB != colsB) {
+    return false;
+  }
+
+  std::vector<Change> changesA = diff(A, previous.A, rowsA, colsA);
+  std::vector<Change> changesB = diff(B, previous.B, colsA, colsB);
+
+  // Each change of A updates a row of C, each change of B a column of C.
+  double work = static_cast<double>(changesA.size()) * colsB + static_cast<double>(changesB.size()) * rowsA;
+  double fullWork = static_cast<double>(rowsA) * colsA * colsB;
+  if (work > maxWorkFraction * fullWork) {
+    return false;
+  }
+
+  for (int i = 0; i < rowsA; ++i) {
+    for (int j = 0; j < colsB; ++j) {
+      C[i][j] = previous.C[i][j];
+    }
+  }
+
+  // (A - A_prev) * B, with the new B.
+  for (const auto &change : changesA) {
+    std::vector<int> &rowC = C[change.row];
+    const std::vector<int> &rowB = B[change.col];
+    for (int j = 0; j < colsB; ++j) {
+      rowC[j] = static_cast<int>(static_cast<unsigned>(rowC[j]) + change.delta * static_cast<unsigned>(rowB[j]));
+    }
+  }
+
+  // A_prev * (B - B_prev), with the previous A.
+  for (const auto &change : changesB) {
+    for (int i = 0; i < rowsA; ++i) {
+      C[i][change.col] = static_cast<int>(static_cast<unsigned>(C[i][change.col]) +
+                                          static_cast<unsigned>(previous.A[i][change.row]) * change.delta);
+    }
+  }
+  return true;
+}
@@ -0,0 +1,153 @@
+#include "matrix_multiplication_abft.hpp"
+#include "matrix_multiplication_distributed.hpp"
+
+namespace {
+
+/**
+ * @brief Runs kernel on checksum-augmented operands: the only place that knows their shape, one extra
+ * row of A and one extra column of B.
+ */
+void multiplyAugmented(const MultiplyKernel &kernel, const std::vector<std::vector<int>> &Ac,
+                       const std::vector<std::vector<int>> &Bc, std::vector<std::vector<int>> &Cc,
+                       int rowsA, int colsA, int colsB) {
+  kernel(Ac, Bc, Cc, rowsA + 1, colsA, colsB + 1);
+}
+
+} // namespace
+
+void encodeChecksums(const std::vector<std::vector<int>> &A,
+                     const std::vector<std::vector<int>> &B,
+                     std::vector<std::vector<int>> &Ac,
+                     std::vector<std::vector<int>> &Bc, int rowsA, int colsA,
+                     int colsB) {
+  // Unsigned sums wrap modulo 2^32 without undefined behavior.
+  Ac.assign(rowsA + 1, std::vector<int>(colsA, 0));
+  std::vector<unsigned> columnSums(colsA, 0u);
+  for (int i = 0; i < rowsA; ++i) {
+    for (int k = 0; k < colsA; ++k) {
+      Ac[i][k] = A[i][k];
+      columnSums[k] += static_cast<unsigned>(A[i][k]);
+    }
+  }
+  for (int k = 0; k < colsA; ++k) {
+    Ac[rowsA][k] = static_cast<int>(columnSums[k]);
+  }
+
+  Bc.assign(colsA, std::vector<int>(colsB + 1, 0));
+  for (int k = 0; k < colsA; ++k) {
+    unsigned rowSum = 0u;
+    for (int j = 0; j < colsB; ++j) {
+      Bc[k][j] = B[k][j];
+      rowSum += static_cast<unsigned>(B[k][j]);
+    }
+    Bc[k][colsB] = static_cast<int>(rowSum);
+  }
+}
+
+AbftReport verifyChecksums(const std::vector<std::vector<int>> &Cc,
+                           std::vector<std::vector<int>> &C, int rowsA, int colsB) {
+  AbftReport report;
+
+  // Difference between the checksum computed by the kernel and the one recomputed from C.
+  std::vector<unsigned> rowDiff(rowsA, 0u);
+  std::vector<unsigned> colDiff(colsB, 0u);
+  for (int i = 0; i < rowsA; ++i) {
+    unsigned rowSum = 0u;
+    for (int j = 0; j < colsB; ++j) {
+      C[i][j] = Cc[i][j];
+      rowSum += static_cast<unsigned>(Cc[i][j]);
+      colDiff[j] += static_cast<unsigned>(Cc[i][j]);
+    }
+    rowDiff[i] = static_cast<unsigned>(Cc[i][colsB]) - rowSum;
+  }
+  for (int j = 0; j < colsB; ++j) {
+    colDiff[j] = static_cast<unsigned>(Cc[rowsA][j]) - colDiff[j];
+  }
+
+  int badRow = -1, badCol = -1;
+  for (int i = 0; i < rowsA; ++i) {
+    if (rowDiff[i] != 0u) {
+      ++report.mismatchedRows;
+      badRow = i;
+    }
+  }
+  for (int j = 0; j < colsB; ++j) {
+    if (colDiff[j] != 0u) {
+      ++report.mismatchedCols;
+      badCol = j;
+    }
+  }
+
+  // The corner entry is the sum of both checksum vectors, it tells a fault in one of them apart from
+  // data faults that cancel out within a row or a column.
+  const unsigned corner = static_cast<unsigned>(Cc[rowsA][colsB]);
+  unsigned checksumRowSum = 0u, checksumColSum = 0u;
+  for (int j = 0; j < colsB; ++j) {
+    checksumRowSum += static_cast<unsigned>(Cc[rowsA][j]);
+  }
+  for (int i = 0; i < rowsA; ++i) {
+    checksumColSum += static_cast<unsigned>(Cc[i][colsB]);
+  }
+  const unsigned cornerRowDiff = checksumRowSum - corner;
+  const unsigned cornerColDiff = checksumColSum - corner;
+
+  report.errorDetected = report.mismatchedRows > 0 || report.mismatchedCols > 0 ||
+                         cornerRowDiff != 0u || cornerColDiff != 0u;
+  if (!report.errorDetected) {
+    return report;
+  }
+
+  if (report.mismatchedRows == 1 && report.mismatchedCols == 1 &&
+      rowDiff[badRow] == colDiff[badCol] && cornerRowDiff == 0u && cornerColDiff == 0u) {
+    // A single wrong entry shifts its row and column checksums by the same amount.
+    C[badRow][badCol] = static_cast<int>(static_cast<unsigned>(C[badRow][badCol]) + rowDiff[badRow]);
+    report.errorCorrected = true;
+    report.faultyRow = badRow;
+    report.faultyCol = badCol;
+  } else if (report.mismatchedRows == 0 && report.mismatchedCols == 1 &&
+             cornerRowDiff == colDiff[badCol] && cornerColDiff == 0u) {
+    // A single wrong entry of the checksum row: the data part of the product is intact.
+    report.errorCorrected = true;
+  } else if (report.mismatchedRows == 1 && report.mismatchedCols == 0 &&
+             cornerColDiff == rowDiff[badRow] && cornerRowDiff == 0u) {
+    // A single wrong entry of the checksum column: the data part of the product is intact.
+    report.errorCorrected = true;
+  } else if (report.mismatchedRows == 0 && report.mismatchedCols == 0 && cornerRowDiff == cornerColDiff) {
+    // Only the corner entry is wrong: both checksum vectors agree with the data.
+    report.errorCorrected = true;
+  }
+  return report;
+}
+
+AbftReport multiplyMatricesABFT(const std::vector<std::vector<int>> &A,
+                                const std::vector<std::vector<int>> &B,
+                                std::vector<std::vector<int>> &C, int rowsA,
+                                int colsA, int colsB, const MultiplyKernel &kernel) {
+  std::vector<std::vector<int>> Ac, Bc;
+  encodeChecksums(A, B, Ac, Bc, rowsA, colsA, colsB);
+
+  std::vector<std::vector<int>> Cc(rowsA + 1, std::vector<int>(colsB + 1, 0));
+  multiplyAugmented(kernel, Ac, Bc, Cc, rowsA, colsA, colsB);
+
+  return verifyChecksums(Cc, C, rowsA, colsB);
+}
+
+AbftReport multiplyMatricesABFTDistributed(const std::vector<std::vector<int>> &A,
+                                           const std::vector<std::vector<int>> &B,
+                                           std::vector<std::vector<int>> &C, int rowsA,
+                                           int colsA, int colsB, MPI_Comm comm) {
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+
+  auto distributedKernel = [comm](const std::vector<std::vector<int>> &Ac,
+                                  const std::vector<std::vector<int>> &Bc,
+                                  std::vector<std::vector<int>> &Cc, int rows, int inner, int cols) {
+    multiplyMatricesDistributed(Ac, Bc, Cc, rows, inner, cols, comm);
+  };
+  if (rank == 0) {
+    return multiplyMatricesABFT(A, B, C, rowsA, colsA, colsB, distributedKernel);
+  }
+  // The other ranks only join the distributed product, their operands are never read.
+  multiplyAugmented(distributedKernel, A, B, C, rowsA, colsA, colsB);
+  return AbftReport();
+}
@@ -0,0 +1,262 @@
+#include "matrix_multiplication_distributed.hpp"
+#include "matrix_multiplication_fixed.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Evenly partitions n items among parts, the first n % parts parts receive one extra item.
+ */
+void partition(int n, int parts, int index, int &begin, int &count) {
+  int base = n / parts;
+  int remainder = n % parts;
+  count = base + (index < remainder ? 1 : 0);
+  begin = index * base + std::min(index, remainder);
+}
+
+/**
+ * @brief Allocates a node-wide shared buffer of ints. Only the node-local rank 0 owns the memory,
+ * every other local rank gets a pointer to the very same segment.
+ */
+int *allocateShared(MPI_Aint elements, MPI_Comm nodeComm, MPI_Win &win) {
+  int nodeRank;
+  MPI_Comm_rank(nodeComm, &nodeRank);
+
+  int *base = nullptr;
+  MPI_Aint bytes = nodeRank == 0 ? elements * static_cast<MPI_Aint>(sizeof(int)) : 0;
+  MPI_Win_allocate_shared(bytes, sizeof(int), MPI_INFO_NULL, nodeComm, &base, &win);
+
+  MPI_Aint ownerBytes;
+  int dispUnit;
+  MPI_Win_shared_query(win, 0, &ownerBytes, &dispUnit, &base);
+  return base;
+}
+
+/**
+ * @brief Computes the block [rowBegin, rowBegin + rowCount) x [colBegin, colBegin + colCount) of the
+ * row band C = A * B with a plain i-k-j loop. A, B and C are dense row-major buffers.
+ */
+void multiplyNaive(const int *A, const int *B, int *C, int colsA, int colsB,
+                   int rowBegin, int rowCount, int colBegin, int colCount) {
+  for (int i = rowBegin; i < rowBegin + rowCount; ++i) {
+    int *rowC = C + static_cast<long>(i) * colsB;
+    for (int j = colBegin; j < colBegin + colCount; ++j) {
+      rowC[j] = 0;
+    }
+    for (int k = 0; k < colsA; ++k) {
+      const int a = A[static_cast<long>(i) * colsA + k];
+      const int *rowB = B + static_cast<long>(k) * colsB;
+      for (int j = colBegin; j < colBegin + colCount; ++j) {
+        rowC[j] += a * rowB[j];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Same block as multiplyNaive, computed tile by tile so that the tiles of A, B and C in use
+ * stay in cache.
+ */
+void multiplyBlocked(const int *A, const int *B, int *C, int colsA, int colsB,
+                     int rowBegin, int rowCount, int colBegin, int colCount,
+                     const TuningParameters &params) {
+  const int tileRows = std::max(1, params.tileRows);
+  const int tileInner = std::max(1, params.tileInner);
+  const int tileCols = std::max(1, params.tileCols);
+  const int rowEnd = rowBegin + rowCount, colEnd = colBegin + colCount;
+
+  for (int ii = rowBegin; ii < rowEnd; ii += tileRows) {
+    const int iEnd = std::min(ii + tileRows, rowEnd);
+    for (int jj = colBegin; jj < colEnd; jj += tileCols) {
+      const int jEnd = std::min(jj + tileCols, colEnd);
+      for (int i = ii; i < iEnd; ++i) {
+        std::fill(C + static_cast<long>(i) * colsB + jj, C + static_cast<long>(i) * colsB + jEnd, 0);
+      }
+      for (int kk = 0; kk < colsA; kk += tileInner) {
+        const int kEnd = std::min(kk + tileInner, colsA);
+        for (int i = ii; i < iEnd; ++i) {
+          int *rowC = C + static_cast<long>(i) * colsB;
+          for (int k = kk; k < kEnd; ++k) {
+            const int a = A[static_cast<long>(i) * colsA + k];
+            const int *rowB = B + static_cast<long>(k) * colsB;
+            for (int j = jj; j < jEnd; ++j) {
+              rowC[j] += a * rowB[j];
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Computes a block of the row band with the kernel selected by params, splitting its rows
+ * among params.threads threads.
+ */
+void multiplyBlock(const int *A, const int *B, int *C, int colsA, int colsB,
+                   int rowBegin, int rowCount, int colBegin, int colCount,
+                   const TuningParameters &params) {
+  auto run = [&](int begin, int count) {
+    if (params.kernel == PanelKernel::Naive) {
+      multiplyNaive(A, B, C, colsA, colsB, begin, count, colBegin, colCount);
+    } else {
+      multiplyBlocked(A, B, C, colsA, colsB, begin, count, colBegin, colCount, params);
+    }
+  };
+
+  const int threads = std::max(1, std::min(params.threads, rowCount));
+  if (threads == 1) {
+    run(rowBegin, rowCount);
+    return;
+  }
+
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; ++t) {
+    int begin, count;
+    partition(rowCount, threads, t, begin, count);
+    pool.emplace_back(run, rowBegin + begin, count);
+  }
+  for (auto &thread : pool) {
+    thread.join();
+  }
+}
+
+} // namespace
+
+void multiplyMatricesDistributed(const std::vector<std::vector<int>> &A,
+                                 const std::vector<std::vector<int>> &B,
+                                 std::vector<std::vector<int>> &C, int rowsA,
+                                 int colsA, int colsB, MPI_Comm comm) {
+  multiplyMatricesDistributed(A, B, C, rowsA, colsA, colsB, comm,
+                              selectTuning(tuningTable(), rowsA, colsA, colsB));
+}
+
+void multiplyMatricesDistributed(const std::vector<std::vector<int>> &A,
+                                 const std::vector<std::vector<int>> &B,
+                                 std::vector<std::vector<int>> &C, int rowsA,
+                                 int colsA, int colsB, MPI_Comm comm,
+                                 const TuningParameters &tuning) {
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+
+  // Small products are cheaper on the root alone than through the communicator. Every rank knows the
+  // sizes, so all of them take this branch together.
+  if (hasFixedSpecialization(rowsA, colsA, colsB)) {
+    if (rank == 0) {
+      multiplyMatricesFixed(A, B, C, rowsA, colsA, colsB);
+    }
+    return;
+  }
+
+  // Node-local group: processes that can share memory. Keying on rank keeps the root at node rank 0.
+  MPI_Comm nodeComm;
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm);
+  int nodeRank, nodeSize;
+  MPI_Comm_rank(nodeComm, &nodeRank);
+  MPI_Comm_size(nodeComm, &nodeSize);
+
+  // Inter-node group: one leader per node, the root is leader 0.
+  MPI_Comm leaderComm;
+  MPI_Comm_split(comm, nodeRank == 0 ? 0 : MPI_UNDEFINED, rank, &leaderComm);
+  int numNodes = 0, nodeIndex = 0;
+  if (leaderComm != MPI_COMM_NULL) {
+    MPI_Comm_size(leaderComm, &numNodes);
+    MPI_Comm_rank(leaderComm, &nodeIndex);
+  }
+  MPI_Bcast(&numNodes, 1, MPI_INT, 0, nodeComm);
+  MPI_Bcast(&nodeIndex, 1, MPI_INT, 0, nodeComm);
+
+  // The root's parameters win, so that every rank agrees on the layout of the local grid.
+  int packed[6] = {static_cast<int>(tuning.kernel), tuning.tileRows, tuning.tileInner,
+                   tuning.tileCols, tuning.threads, tuning.gridRows};
+  MPI_Bcast(packed, 6, MPI_INT, 0, comm);
+  TuningParameters params = tuning;
+  params.kernel = static_cast<PanelKernel>(packed[0]);
+  params.tileRows = packed[1];
+  params.tileInner = packed[2];
+  params.tileCols = packed[3];
+  params.threads = packed[4];
+  params.gridRows = packed[5];
+
+  // Grid row: the node owns a band of rows of A and C.
+  int bandBegin, bandRows;
+  partition(rowsA, numNodes, nodeIndex, bandBegin, bandRows);
+
+  MPI_Win winA, winB, winC;
+  int *sharedA = allocateShared(static_cast<MPI_Aint>(bandRows) * colsA, nodeComm, winA);
+  int *sharedB = allocateShared(static_cast<MPI_Aint>(colsA) * colsB, nodeComm, winB);
+  int *sharedC = allocateShared(static_cast<MPI_Aint>(bandRows) * colsB, nodeComm, winC);
+
+  MPI_Win_fence(0, winA);
+  MPI_Win_fence(0, winB);
+
+  // Only the leaders talk across nodes: scatter the bands of A, broadcast B once per node.
+  if (leaderComm != MPI_COMM_NULL) {
+    std::vector<int> flatA;
+    std::vector<int> counts(numNodes), displs(numNodes);
+    if (nodeIndex == 0) {
+      flatA.reserve(static_cast<size_t>(rowsA) * colsA);
+      for (int i = 0; i < rowsA; ++i) {
+        flatA.insert(flatA.end(), A[i].begin(), A[i].begin() + colsA);
+      }
+      for (int k = 0; k < colsA; ++k) {
+        std::copy(B[k].begin(), B[k].begin() + colsB, sharedB + static_cast<long>(k) * colsB);
+      }
+      for (int n = 0; n < numNodes; ++n) {
+        int begin, rows;
+        partition(rowsA, numNodes, n, begin, rows);
+        counts[n] = rows * colsA;
+        displs[n] = begin * colsA;
+      }
+    }
+    MPI_Scatterv(flatA.data(), counts.data(), displs.data(), MPI_INT, sharedA,
+                 bandRows * colsA, MPI_INT, 0, leaderComm);
+    MPI_Bcast(sharedB, colsA * colsB, MPI_INT, 0, leaderComm);
+  }
+
+  MPI_Win_fence(0, winA);
+  MPI_Win_fence(0, winB);
+
+  // Local grid: each local rank computes a block of the band straight from the shared windows.
+  int gridRows = params.gridRows >= 1 && nodeSize % params.gridRows == 0 ? params.gridRows : 1;
+  int gridCols = nodeSize / gridRows;
+  int blockRowBegin, blockRows, blockColBegin, blockCols;
+  partition(bandRows, gridRows, nodeRank / gridCols, blockRowBegin, blockRows);
+  partition(colsB, gridCols, nodeRank % gridCols, blockColBegin, blockCols);
+
+  MPI_Win_fence(0, winC);
+  multiplyBlock(sharedA, sharedB, sharedC, colsA, colsB, blockRowBegin, blockRows,
+                blockColBegin, blockCols, params);
+  MPI_Win_fence(0, winC);
+
+  // Leaders gather the bands of C back to the root.
+  if (leaderComm != MPI_COMM_NULL) {
+    std::vector<int> flatC;
+    std::vector<int> counts(numNodes), displs(numNodes);
+    if (nodeIndex == 0) {
+      flatC.resize(static_cast<size_t>(rowsA) * colsB);
+      for (int n = 0; n < numNodes; ++n) {
+        int begin, rows;
+        partition(rowsA, numNodes, n, begin, rows);
+        counts[n] = rows * colsB;
+        displs[n] = begin * colsB;
+      }
+    }
+    MPI_Gatherv(sharedC, bandRows * colsB, MPI_INT, flatC.data(), counts.data(),
+                displs.data(), MPI_INT, 0, leaderComm);
+
+    if (nodeIndex == 0) {
+      for (int i = 0; i < rowsA; ++i) {
+        std::copy(flatC.begin() + static_cast<long>(i) * colsB,
+                  flatC.begin() + static_cast<long>(i + 1) * colsB, C[i].begin());
+      }
+    }
+    MPI_Comm_free(&leaderComm);
+  }
+
+  MPI_Win_free(&winC);
+  MPI_Win_free(&winB);
+  MPI_Win_free(&winA);
+  MPI_Comm_free(&nodeComm);
+}
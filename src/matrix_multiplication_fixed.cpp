@@ -0,0 +1,60 @@
+#include "matrix_multiplication_fixed.hpp"
+
+namespace {
+
+using Matrix = std::vector<std::vector<int>>;
+using FixedEntry = void (*)(const Matrix &, const Matrix &, Matrix &);
+
+/**
+ * @brief Copies the runtime operands onto the stack, runs the specialization and copies C back.
+ */
+template <std::size_t M, std::size_t K, std::size_t N>
+void multiplyFixedEntry(const Matrix &A, const Matrix &B, Matrix &C) {
+  FixedMatrix<M, K> a;
+  FixedMatrix<K, N> b;
+  for (std::size_t i = 0; i < M; ++i)
+    for (std::size_t k = 0; k < K; ++k)
+      a[i][k] = A[i][k];
+  for (std::size_t k = 0; k < K; ++k)
+    for (std::size_t j = 0; j < N; ++j)
+      b[k][j] = B[k][j];
+
+  const FixedMatrix<M, N> c = multiply<M, K, N>(a, b);
+  for (std::size_t i = 0; i < M; ++i)
+    for (std::size_t j = 0; j < N; ++j)
+      C[i][j] = c[i][j];
+}
+
+constexpr std::size_t shapeSize = maxFixedShapeSize;
+
+// Entry I of the shape table handles sizes (I / S^2 + 1) x (I / S % S + 1) x (I % S + 1).
+template <std::size_t... I>
+constexpr std::array<FixedEntry, sizeof...(I)> makeShapeTable(std::index_sequence<I...>) {
+  return {{&multiplyFixedEntry<I / (shapeSize * shapeSize) + 1, I / shapeSize % shapeSize + 1, I % shapeSize + 1>...}};
+}
+
+// Entry I of the square table handles sizes (I + 1) x (I + 1) x (I + 1).
+template <std::size_t... I>
+constexpr std::array<FixedEntry, sizeof...(I)> makeSquareTable(std::index_sequence<I...>) {
+  return {{&multiplyFixedEntry<I + 1, I + 1, I + 1>...}};
+}
+
+constexpr auto shapeTable = makeShapeTable(std::make_index_sequence<shapeSize * shapeSize * shapeSize>{});
+constexpr auto squareTable = makeSquareTable(std::make_index_sequence<maxFixedSquareSize>{});
+
+} // namespace
+
+bool multiplyMatricesFixed(const std::vector<std::vector<int>> &A,
+                           const std::vector<std::vector<int>> &B,
+                           std::vector<std::vector<int>> &C, int rowsA, int colsA,
+                           int colsB) {
+  if (!hasFixedSpecialization(rowsA, colsA, colsB)) {
+    return false;
+  }
+  if (rowsA <= maxFixedShapeSize && colsA <= maxFixedShapeSize && colsB <= maxFixedShapeSize) {
+    shapeTable[((rowsA - 1) * shapeSize + (colsA - 1)) * shapeSize + (colsB - 1)](A, B, C);
+    return true;
+  }
+  squareTable[rowsA - 1](A, B, C);
+  return true;
+}
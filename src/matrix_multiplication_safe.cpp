@@ -0,0 +1,112 @@
+#include "matrix_multiplication_safe.hpp"
+#include <algorithm>
+#include <climits>
+
+namespace {
+
+using int128 = __int128;
+
+int128 maxAbs(const std::vector<std::vector<int>> &M, int rows, int cols) {
+  int128 result = 0;
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      result = std::max(result, M[i][j] < 0 ? -static_cast<int128>(M[i][j]) : static_cast<int128>(M[i][j]));
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Shared int64 kernel. Each row of C is accumulated in int64; store(i, j, exact) receives the
+ * exact entry and returns whether it overflowed the destination type.
+ *
+ * A single product A[i][k] * B[k][j] always fits in int64, only the running sums can overflow. When the
+ * bound colsA * max|A| * max|B| rules that out, the inner loop is a plain int64 multiply-add; otherwise
+ * every addition is checked and the entries that overflow are recomputed in 128-bit arithmetic.
+ */
+template <typename Store>
+int multiplyWidenedKernel(const std::vector<std::vector<int>> &A,
+                          const std::vector<std::vector<int>> &B, int rowsA,
+                          int colsA, int colsB, Store store) {
+  const bool mayOverflow = static_cast<int128>(colsA) * maxAbs(A, rowsA, colsA) * maxAbs(B, colsA, colsB) >
+                           static_cast<int128>(INT64_MAX);
+
+  std::vector<int64_t> acc(colsB);
+  std::vector<unsigned char> wide(colsB);
+  int overflows = 0;
+  for (int i = 0; i < rowsA; ++i) {
+    std::fill(acc.begin(), acc.end(), 0);
+    std::fill(wide.begin(), wide.end(), 0);
+
+    for (int k = 0; k < colsA; ++k) {
+      const int64_t a = A[i][k];
+      const int *rowB = B[k].data();
+      if (!mayOverflow) {
+        for (int j = 0; j < colsB; ++j) {
+          acc[j] += a * rowB[j];
+        }
+      } else {
+        for (int j = 0; j < colsB; ++j) {
+          wide[j] |= __builtin_add_overflow(acc[j], a * rowB[j], &acc[j]);
+        }
+      }
+    }
+
+    for (int j = 0; j < colsB; ++j) {
+      int128 exact = acc[j];
+      if (wide[j]) {
+        exact = 0;
+        for (int k = 0; k < colsA; ++k) {
+          exact += static_cast<int128>(A[i][k]) * B[k][j];
+        }
+      }
+      overflows += store(i, j, exact) ? 1 : 0;
+    }
+  }
+  return overflows;
+}
+
+} // namespace
+
+int multiplyMatricesWidened(const std::vector<std::vector<int>> &A,
+                            const std::vector<std::vector<int>> &B,
+                            std::vector<std::vector<int64_t>> &C, int rowsA,
+                            int colsA, int colsB) {
+  return multiplyWidenedKernel(A, B, rowsA, colsA, colsB, [&C](int i, int j, int128 exact) {
+    if (exact > INT64_MAX || exact < INT64_MIN) {
+      C[i][j] = exact > 0 ? INT64_MAX : INT64_MIN;
+      return true;
+    }
+    C[i][j] = static_cast<int64_t>(exact);
+    return false;
+  });
+}
+
+int multiplyMatricesSaturating(const std::vector<std::vector<int>> &A,
+                               const std::vector<std::vector<int>> &B,
+                               std::vector<std::vector<int>> &C, int rowsA,
+                               int colsA, int colsB) {
+  return multiplyWidenedKernel(A, B, rowsA, colsA, colsB, [&C](int i, int j, int128 exact) {
+    if (exact > INT_MAX || exact < INT_MIN) {
+      C[i][j] = exact > 0 ? INT_MAX : INT_MIN;
+      return true;
+    }
+    C[i][j] = static_cast<int>(exact);
+    return false;
+  });
+}
+
+int multiplyMatricesFlagged(const std::vector<std::vector<int>> &A,
+                            const std::vector<std::vector<int>> &B,
+                            std::vector<std::vector<int>> &C,
+                            std::vector<std::vector<bool>> &overflowed, int rowsA,
+                            int colsA, int colsB) {
+  overflowed.assign(rowsA, std::vector<bool>(colsB, false));
+  return multiplyWidenedKernel(A, B, rowsA, colsA, colsB, [&C, &overflowed](int i, int j, int128 exact) {
+    bool overflow = exact > INT_MAX || exact < INT_MIN;
+    // Wrap modulo 2^32 through unsigned arithmetic, which is well defined.
+    C[i][j] = static_cast<int>(static_cast<uint32_t>(static_cast<unsigned __int128>(exact)));
+    overflowed[i][j] = overflow;
+    return overflow;
+  });
+}
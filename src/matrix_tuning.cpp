@@ -0,0 +1,220 @@
+#include "matrix_tuning.hpp"
+#include "matrix_multiplication_distributed.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+std::vector<TuningParameters> &globalTable() {
+  static std::vector<TuningParameters> table = [] {
+    const char *filename = std::getenv("MM_TUNING_FILE");
+    return loadTuningFile(filename != nullptr ? filename : "tuning.txt");
+  }();
+  return table;
+}
+
+/**
+ * @brief Times the distributed product with the given parameters, keeping the best of a few runs.
+ * @note Collective over comm. The parameters and the returned time are only meaningful on rank 0.
+ */
+double benchmark(const std::vector<std::vector<int>> &A,
+                 const std::vector<std::vector<int>> &B,
+                 std::vector<std::vector<int>> &C, int n, MPI_Comm comm,
+                 const TuningParameters &params) {
+  const int repetitions = 3;
+  double best = 0.0;
+  for (int r = 0; r < repetitions; ++r) {
+    MPI_Barrier(comm);
+    double start = MPI_Wtime();
+    multiplyMatricesDistributed(A, B, C, n, n, n, comm, params);
+    MPI_Barrier(comm);
+    double elapsed = MPI_Wtime() - start;
+    best = r == 0 ? elapsed : std::min(best, elapsed);
+  }
+  return best;
+}
+
+/**
+ * @brief Benchmarks the candidates built by rank 0 and returns the fastest one on rank 0.
+ * The other ranks only learn how many products they have to join.
+ */
+TuningParameters pickFastest(const std::vector<TuningParameters> &candidates,
+                             const std::vector<std::vector<int>> &A,
+                             const std::vector<std::vector<int>> &B,
+                             std::vector<std::vector<int>> &C, int n, MPI_Comm comm) {
+  int count = static_cast<int>(candidates.size());
+  MPI_Bcast(&count, 1, MPI_INT, 0, comm);
+
+  TuningParameters fastest = candidates.empty() ? TuningParameters() : candidates[0];
+  double fastestTime = 0.0;
+  for (int c = 0; c < count; ++c) {
+    const TuningParameters params = candidates.empty() ? TuningParameters() : candidates[c];
+    double elapsed = benchmark(A, B, C, n, comm, params);
+    if (c == 0 || elapsed < fastestTime) {
+      fastest = params;
+      fastestTime = elapsed;
+    }
+  }
+  return fastest;
+}
+
+} // namespace
+
+std::vector<TuningParameters> loadTuningFile(const std::string &filename) {
+  std::vector<TuningParameters> table;
+  std::ifstream infile(filename);
+  std::string line;
+  while (std::getline(infile, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream fields(line);
+    TuningParameters params;
+    std::string kernel;
+    if (!(fields >> params.maxSize >> kernel >> params.tileRows >> params.tileInner >>
+          params.tileCols >> params.threads >> params.gridRows)) {
+      continue;
+    }
+    if (kernel == "naive") {
+      params.kernel = PanelKernel::Naive;
+    } else if (kernel == "blocked") {
+      params.kernel = PanelKernel::Blocked;
+    } else {
+      continue;
+    }
+    if (params.tileRows <= 0 || params.tileInner <= 0 || params.tileCols <= 0 || params.threads <= 0 ||
+        params.gridRows <= 0) {
+      continue;
+    }
+    table.push_back(params);
+  }
+  std::sort(table.begin(), table.end(),
+            [](const TuningParameters &a, const TuningParameters &b) { return a.maxSize < b.maxSize; });
+  return table;
+}
+
+bool saveTuningFile(const std::string &filename, const std::vector<TuningParameters> &table) {
+  std::ofstream outfile(filename);
+  if (!outfile) {
+    return false;
+  }
+  outfile << "# maxSize kernel tileRows tileInner tileCols threads gridRows" << std::endl;
+  for (const auto &params : table) {
+    outfile << params.maxSize << " " << (params.kernel == PanelKernel::Naive ? "naive" : "blocked")
+            << " " << params.tileRows << " " << params.tileInner << " " << params.tileCols << " "
+            << params.threads << " " << params.gridRows << std::endl;
+  }
+  return static_cast<bool>(outfile);
+}
+
+TuningParameters selectTuning(const std::vector<TuningParameters> &table, int rowsA, int colsA, int colsB) {
+  if (table.empty()) {
+    return TuningParameters();
+  }
+  const int size = std::max(rowsA, std::max(colsA, colsB));
+  for (const auto &params : table) {
+    if (size <= params.maxSize) {
+      return params;
+    }
+  }
+  return table.back();
+}
+
+const std::vector<TuningParameters> &tuningTable() { return globalTable(); }
+
+void setTuningTable(const std::vector<TuningParameters> &table) {
+  std::vector<TuningParameters> sorted = table;
+  std::sort(sorted.begin(), sorted.end(),
+            [](const TuningParameters &a, const TuningParameters &b) { return a.maxSize < b.maxSize; });
+  globalTable() = sorted;
+}
+
+std::vector<TuningParameters> autotune(const std::vector<int> &sizes, MPI_Comm comm) {
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+
+  MPI_Comm nodeComm;
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm);
+  int nodeSize;
+  MPI_Comm_size(nodeComm, &nodeSize);
+  MPI_Comm_free(&nodeComm);
+
+  const int cores = std::max(1u, std::thread::hardware_concurrency());
+  const int threadsPerRank = std::max(1, cores / nodeSize);
+
+  std::vector<TuningParameters> table;
+  for (int n : sizes) {
+    // Representative square product, only the root holds the operands.
+    std::vector<std::vector<int>> A, B, C;
+    if (rank == 0) {
+      std::mt19937 gen(n);
+      std::uniform_int_distribution<> dis(-100, 100);
+      A.assign(n, std::vector<int>(n));
+      B.assign(n, std::vector<int>(n));
+      C.assign(n, std::vector<int>(n, 0));
+      for (auto &row : A)
+        for (auto &elem : row)
+          elem = dis(gen);
+      for (auto &row : B)
+        for (auto &elem : row)
+          elem = dis(gen);
+    }
+
+    TuningParameters best;
+    best.maxSize = n;
+    best.threads = 1;
+    best.gridRows = 1;
+
+    // Kernel and tile sizes.
+    std::vector<TuningParameters> candidates;
+    if (rank == 0) {
+      TuningParameters naive = best;
+      naive.kernel = PanelKernel::Naive;
+      candidates.push_back(naive);
+      for (int tileRows : {16, 64}) {
+        for (int tileInner : {64, 256}) {
+          for (int tileCols : {128, 512}) {
+            TuningParameters blocked = best;
+            blocked.kernel = PanelKernel::Blocked;
+            blocked.tileRows = tileRows;
+            blocked.tileInner = tileInner;
+            blocked.tileCols = tileCols;
+            candidates.push_back(blocked);
+          }
+        }
+      }
+    }
+    best = pickFastest(candidates, A, B, C, n, comm);
+
+    // Threads per rank.
+    candidates.clear();
+    if (rank == 0) {
+      for (int threads = 1; threads < threadsPerRank; threads *= 2) {
+        candidates.push_back(best);
+        candidates.back().threads = threads;
+      }
+      candidates.push_back(best);
+      candidates.back().threads = threadsPerRank;
+    }
+    best = pickFastest(candidates, A, B, C, n, comm);
+
+    // Shape of the local grid.
+    candidates.clear();
+    if (rank == 0) {
+      for (int gridRows = 1; gridRows <= nodeSize; ++gridRows) {
+        if (nodeSize % gridRows == 0) {
+          candidates.push_back(best);
+          candidates.back().gridRows = gridRows;
+        }
+      }
+    }
+    best = pickFastest(candidates, A, B, C, n, comm);
+
+    table.push_back(best);
+  }
+  return table;
+}
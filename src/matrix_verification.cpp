@@ -0,0 +1,83 @@
+#include "matrix_verification.hpp"
+#include <random>
+
+bool verifyProductFreivalds(const std::vector<std::vector<int>> &A,
+                            const std::vector<std::vector<int>> &B,
+                            const std::vector<std::vector<int>> &C, int rowsA,
+                            int colsA, int colsB, int iterations, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::bernoulli_distribution coin(0.5);
+
+  // Unsigned accumulators wrap modulo 2^32 without undefined behavior.
+  std::vector<unsigned> r(colsB), Br(colsA);
+  for (int it = 0; it < iterations; ++it) {
+    for (int j = 0; j < colsB; ++j) {
+      r[j] = coin(gen) ? 1u : 0u;
+    }
+
+    for (int k = 0; k < colsA; ++k) {
+      unsigned sum = 0u;
+      for (int j = 0; j < colsB; ++j) {
+        sum += static_cast<unsigned>(B[k][j]) * r[j];
+      }
+      Br[k] = sum;
+    }
+
+    for (int i = 0; i < rowsA; ++i) {
+      unsigned ABr = 0u, Cr = 0u;
+      for (int k = 0; k < colsA; ++k) {
+        ABr += static_cast<unsigned>(A[i][k]) * Br[k];
+      }
+      for (int j = 0; j < colsB; ++j) {
+        Cr += static_cast<unsigned>(C[i][j]) * r[j];
+      }
+      if (ABr != Cr) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool verifyProductFreivaldsDistributed(const std::vector<std::vector<int>> &A,
+                                       const std::vector<std::vector<int>> &B,
+                                       const std::vector<std::vector<int>> &C,
+                                       int rowsA, int colsA, int colsB,
+                                       int iterations, unsigned seed,
+                                       MPI_Comm comm) {
+  int rank, size;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+
+  // The root works on the caller's matrices, the other ranks on broadcast copies.
+  std::vector<std::vector<int>> copyA, copyB, copyC;
+  if (rank != 0) {
+    copyA.assign(rowsA, std::vector<int>(colsA));
+    copyB.assign(colsA, std::vector<int>(colsB));
+    copyC.assign(rowsA, std::vector<int>(colsB));
+  }
+  const auto &localA = rank == 0 ? A : copyA;
+  const auto &localB = rank == 0 ? B : copyB;
+  const auto &localC = rank == 0 ? C : copyC;
+
+  if (size > 1) {
+    for (int i = 0; i < rowsA; ++i) {
+      MPI_Bcast(const_cast<int *>(localA[i].data()), colsA, MPI_INT, 0, comm);
+    }
+    for (int k = 0; k < colsA; ++k) {
+      MPI_Bcast(const_cast<int *>(localB[k].data()), colsB, MPI_INT, 0, comm);
+    }
+    for (int i = 0; i < rowsA; ++i) {
+      MPI_Bcast(const_cast<int *>(localC[i].data()), colsB, MPI_INT, 0, comm);
+    }
+  }
+
+  // Each rank draws its own share of the random vectors from an independent stream.
+  int localIterations = iterations / size + (rank < iterations % size ? 1 : 0);
+  int localVerdict = verifyProductFreivalds(localA, localB, localC, rowsA, colsA, colsB,
+                                            localIterations, seed + static_cast<unsigned>(rank)) ? 1 : 0;
+
+  int verdict;
+  MPI_Allreduce(&localVerdict, &verdict, 1, MPI_INT, MPI_LAND, comm);
+  return verdict != 0;
+}
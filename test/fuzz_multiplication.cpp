@@ -0,0 +1,397 @@
+/**
+ * @file fuzz_multiplication.cpp
+ * @brief Parallel property-based fuzzer for the multiplication backends.
+ *
+ * Every case is generated from its own seed, so any failure can be replayed with --seed and --first.
+ * Shapes are biased toward tile and vector-width boundaries (multiples of 4, 8, 16, 32, 64 and their
+ * neighbours) where blocked tiles, edge remainders and SIMD tails live, and up to --max-size.
+ * Each product is compared against the trusted function, or against Freivalds' check when the trusted
+ * product would be too expensive. A failing case is shrunk to a minimal reproducer (smaller sizes,
+ * zeroed entries) that is printed together with its seed.
+ *
+ * Cases are spread over --threads worker threads (all cores by default). The "distributed" backend
+ * runs on MPI_COMM_WORLD: launched with mpirun, rank 0 fuzzes and the other ranks serve the
+ * distributed products.
+ *
+ * Usage: ./fuzz_multiplication [--backend=library,trusted,abft,distributed,fixed,saturating] [--iterations=N]
+ *                              [--max-size=N] [--seed=N] [--first=N] [--threads=N]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <mpi.h>
+#include "matrix_multiplication.h"
+#include "matrix_multiplication_abft.hpp"
+#include "matrix_multiplication_distributed.hpp"
+#include "matrix_multiplication_fixed.hpp"
+#include "matrix_multiplication_safe.hpp"
+#include "matrix_multiplication_trusted.hpp"
+#include "matrix_verification.hpp"
+
+using Matrix = std::vector<std::vector<int>>;
+
+namespace {
+
+// Products with more multiply-adds than this are checked with Freivalds instead of the trusted product.
+const long long referenceBudget = 1LL << 24;
+
+struct FuzzCase {
+    Matrix A, B;
+    int rowsA, colsA, colsB;
+};
+
+std::mutex mpiMutex;
+
+/**
+ * @brief Distributed backend driven by rank 0: the sizes are broadcast first so that the serving
+ * ranks can join the collective product. Calls are serialized because MPI runs at MPI_THREAD_SERIALIZED.
+ */
+void distributedKernel(const Matrix& A, const Matrix& B, Matrix& C, int rowsA, int colsA, int colsB) {
+    std::lock_guard<std::mutex> lock(mpiMutex);
+    int sizes[3] = {rowsA, colsA, colsB};
+    MPI_Bcast(sizes, 3, MPI_INT, 0, MPI_COMM_WORLD);
+    multiplyMatricesDistributed(A, B, C, rowsA, colsA, colsB, MPI_COMM_WORLD);
+}
+
+/**
+ * @brief Loop run by ranks other than 0: join distributed products until rank 0 sends negative sizes.
+ */
+void serveDistributed() {
+    Matrix A, B, C;
+    while (true) {
+        int sizes[3];
+        MPI_Bcast(sizes, 3, MPI_INT, 0, MPI_COMM_WORLD);
+        if (sizes[0] < 0) {
+            return;
+        }
+        multiplyMatricesDistributed(A, B, C, sizes[0], sizes[1], sizes[2], MPI_COMM_WORLD);
+    }
+}
+
+/**
+ * @brief Releases the ranks waiting in serveDistributed. Rank 0 must call it on every exit path.
+ */
+void stopServers() {
+    int stop[3] = {-1, -1, -1};
+    MPI_Bcast(stop, 3, MPI_INT, 0, MPI_COMM_WORLD);
+}
+
+std::map<std::string, MultiplyKernel> availableBackends() {
+    return {
+        {"library", multiplyMatrices},
+        {"trusted", multiplyMatricesWithoutErrors},
+        {"abft", [](const Matrix& A, const Matrix& B, Matrix& C, int rowsA, int colsA, int colsB) {
+             multiplyMatricesABFT(A, B, C, rowsA, colsA, colsB);
+         }},
+        {"distributed", distributedKernel},
+        {"fixed", [](const Matrix& A, const Matrix& B, Matrix& C, int rowsA, int colsA, int colsB) {
+             if (!multiplyMatricesFixed(A, B, C, rowsA, colsA, colsB)) {
+                 multiplyMatricesWithoutErrors(A, B, C, rowsA, colsA, colsB);
+             }
+         }},
+        {"saturating", [](const Matrix& A, const Matrix& B, Matrix& C, int rowsA, int colsA, int colsB) {
+             multiplyMatricesSaturating(A, B, C, rowsA, colsA, colsB);
+         }},
+    };
+}
+
+/**
+ * @brief Picks a size in [1, maxSize], biased toward tile and vector-width boundaries.
+ */
+int pickSize(std::mt19937& gen, int maxSize) {
+    static const int boundaries[] = {4, 8, 16, 32, 64};
+    std::uniform_int_distribution<> kind(0, 9);
+    int k = kind(gen);
+    if (k < 6) {
+        // A multiple of a boundary, possibly off by one.
+        std::uniform_int_distribution<> which(0, 4);
+        int width = boundaries[which(gen)];
+        int multiples = std::max(1, maxSize / width);
+        std::uniform_int_distribution<> multiple(1, multiples);
+        std::uniform_int_distribution<> offset(-1, 1);
+        int size = width * multiple(gen) + offset(gen);
+        return std::min(std::max(size, 1), maxSize);
+    }
+    if (k < 7) {
+        std::uniform_int_distribution<> tiny(1, 3);
+        return std::min(tiny(gen), maxSize);
+    }
+    std::uniform_int_distribution<> any(1, maxSize);
+    return any(gen);
+}
+
+FuzzCase generateCase(unsigned seed, int maxSize) {
+    std::mt19937 gen(seed);
+    FuzzCase fuzzCase;
+    fuzzCase.rowsA = pickSize(gen, maxSize);
+    fuzzCase.colsA = pickSize(gen, maxSize);
+    fuzzCase.colsB = pickSize(gen, maxSize);
+
+    // Mostly small values, sometimes wider ones. Both stay far from int overflow for the sizes above.
+    std::bernoulli_distribution wide(0.2);
+    int range = wide(gen) ? 1000 : 100;
+    std::uniform_int_distribution<> dis(-range, range);
+    fuzzCase.A.assign(fuzzCase.rowsA, std::vector<int>(fuzzCase.colsA));
+    fuzzCase.B.assign(fuzzCase.colsA, std::vector<int>(fuzzCase.colsB));
+    for (auto& row : fuzzCase.A)
+        for (auto& elem : row)
+            elem = dis(gen);
+    for (auto& row : fuzzCase.B)
+        for (auto& elem : row)
+            elem = dis(gen);
+    return fuzzCase;
+}
+
+/**
+ * @brief Runs the backend on the case and checks its result. Returns true when the product is wrong.
+ */
+bool fails(const MultiplyKernel& kernel, const FuzzCase& fuzzCase, Matrix& C) {
+    C.assign(fuzzCase.rowsA, std::vector<int>(fuzzCase.colsB, 0));
+    kernel(fuzzCase.A, fuzzCase.B, C, fuzzCase.rowsA, fuzzCase.colsA, fuzzCase.colsB);
+
+    long long work = 1LL * fuzzCase.rowsA * fuzzCase.colsA * fuzzCase.colsB;
+    if (work <= referenceBudget) {
+        Matrix expected(fuzzCase.rowsA, std::vector<int>(fuzzCase.colsB, 0));
+        multiplyMatricesWithoutErrors(fuzzCase.A, fuzzCase.B, expected, fuzzCase.rowsA, fuzzCase.colsA, fuzzCase.colsB);
+        return C != expected;
+    }
+    return !verifyProductFreivalds(fuzzCase.A, fuzzCase.B, C, fuzzCase.rowsA, fuzzCase.colsA, fuzzCase.colsB, 20, 0u);
+}
+
+FuzzCase resized(const FuzzCase& fuzzCase, int rowsA, int colsA, int colsB) {
+    FuzzCase smaller;
+    smaller.rowsA = rowsA;
+    smaller.colsA = colsA;
+    smaller.colsB = colsB;
+    smaller.A.assign(rowsA, std::vector<int>(colsA));
+    smaller.B.assign(colsA, std::vector<int>(colsB));
+    for (int i = 0; i < rowsA; ++i)
+        for (int k = 0; k < colsA; ++k)
+            smaller.A[i][k] = fuzzCase.A[i][k];
+    for (int k = 0; k < colsA; ++k)
+        for (int j = 0; j < colsB; ++j)
+            smaller.B[k][j] = fuzzCase.B[k][j];
+    return smaller;
+}
+
+/**
+ * @brief Greedily shrinks a failing case: first the sizes (halving, then one at a time), then the
+ * entries (zeroing them, then replacing them with 1). Every accepted step still fails.
+ */
+FuzzCase shrink(const MultiplyKernel& kernel, FuzzCase fuzzCase) {
+    Matrix C;
+    int budget = 5000;
+
+    bool progress = true;
+    while (progress && budget > 0) {
+        progress = false;
+        int dims[3] = {fuzzCase.rowsA, fuzzCase.colsA, fuzzCase.colsB};
+        for (int d = 0; d < 3 && !progress; ++d) {
+            for (int smaller : {dims[d] / 2, dims[d] - 1}) {
+                if (smaller < 1 || smaller >= dims[d] || budget-- <= 0) {
+                    continue;
+                }
+                int candidate[3] = {dims[0], dims[1], dims[2]};
+                candidate[d] = smaller;
+                FuzzCase attempt = resized(fuzzCase, candidate[0], candidate[1], candidate[2]);
+                if (fails(kernel, attempt, C)) {
+                    fuzzCase = attempt;
+                    progress = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (int replacement : {0, 1}) {
+        for (Matrix* M : {&fuzzCase.A, &fuzzCase.B}) {
+            for (auto& row : *M) {
+                for (auto& elem : row) {
+                    if (elem == replacement || elem == 0 || budget-- <= 0) {
+                        continue;
+                    }
+                    int previous = elem;
+                    elem = replacement;
+                    if (!fails(kernel, fuzzCase, C)) {
+                        elem = previous;
+                    }
+                }
+            }
+        }
+    }
+    return fuzzCase;
+}
+
+void printMatrix(std::ostream& out, const char* name, const Matrix& M) {
+    if (M.size() * (M.empty() ? 0 : M[0].size()) > 1024) {
+        out << name << " = (too large to print, replay the case)" << std::endl;
+        return;
+    }
+    out << name << " =" << std::endl;
+    for (const auto& row : M) {
+        out << "   ";
+        for (const auto& elem : row) {
+            out << " " << elem;
+        }
+        out << std::endl;
+    }
+}
+
+std::vector<std::string> split(const std::string& list) {
+    std::vector<std::string> items;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        items.push_back(item);
+    }
+    return items;
+}
+
+/**
+ * @brief Parses a whole decimal integer in [min, max] without throwing.
+ * @return false, leaving result untouched, if the value is malformed or out of range.
+ */
+bool parseInteger(const std::string& value, long long min, long long max, long long& result) {
+    char* end = nullptr;
+    errno = 0;
+    long long parsed = std::strtoll(value.c_str(), &end, 10);
+    if (end == value.c_str() || *end != '\0' || errno == ERANGE || parsed < min || parsed > max) {
+        return false;
+    }
+    result = parsed;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &provided);
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    auto backends = availableBackends();
+    std::vector<std::string> selected = {"library", "trusted", "abft", "distributed", "fixed", "saturating"};
+    int iterations = 1000;
+    int maxSize = 256;
+    unsigned seed = std::random_device{}();
+    int first = 0;
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+        long long number = 0;
+        bool valid = true;
+        if (arg.rfind("--backend=", 0) == 0) {
+            selected = split(value);
+        } else if (arg.rfind("--iterations=", 0) == 0) {
+            valid = parseInteger(value, 0, INT_MAX, number);
+            iterations = valid ? static_cast<int>(number) : iterations;
+        } else if (arg.rfind("--max-size=", 0) == 0) {
+            valid = parseInteger(value, 1, INT_MAX, number);
+            maxSize = valid ? static_cast<int>(number) : maxSize;
+        } else if (arg.rfind("--seed=", 0) == 0) {
+            valid = parseInteger(value, 0, UINT_MAX, number);
+            seed = valid ? static_cast<unsigned>(number) : seed;
+        } else if (arg.rfind("--first=", 0) == 0) {
+            valid = parseInteger(value, 0, INT_MAX, number);
+            first = valid ? static_cast<int>(number) : first;
+        } else if (arg.rfind("--threads=", 0) == 0) {
+            valid = parseInteger(value, 1, INT_MAX, number);
+            threads = valid ? static_cast<int>(number) : threads;
+        } else if (rank == 0) {
+            std::cerr << "Ignoring unknown option: " << arg << std::endl;
+        }
+        if (!valid && rank == 0) {
+            std::cerr << "Ignoring invalid option: " << arg << " (expected a non-negative integer, positive for sizes and threads)" << std::endl;
+        }
+    }
+
+    if (rank != 0) {
+        serveDistributed();
+        MPI_Finalize();
+        return 0;
+    }
+
+    for (const auto& name : selected) {
+        if (backends.find(name) == backends.end()) {
+            std::cerr << "Unknown backend: " << name << std::endl;
+            stopServers();
+            MPI_Finalize();
+            return 2;
+        }
+    }
+    if (provided < MPI_THREAD_SERIALIZED &&
+        std::find(selected.begin(), selected.end(), "distributed") != selected.end()) {
+        threads = 1;
+    }
+
+    std::cout << "Fuzzing " << iterations << " cases up to " << maxSize << " on " << threads
+              << " threads, seed: " << seed << std::endl;
+
+    std::atomic<int> nextCase(first);
+    std::atomic<int> failures(0);
+    std::mutex outputMutex;
+
+    auto worker = [&]() {
+        Matrix C;
+        for (int index = nextCase++; index < first + iterations; index = nextCase++) {
+            // Case seeds are derived from the run seed and the case index only, not from the thread.
+            std::seed_seq sequence{seed, static_cast<unsigned>(index)};
+            unsigned caseSeed;
+            sequence.generate(&caseSeed, &caseSeed + 1);
+            FuzzCase fuzzCase = generateCase(caseSeed, maxSize);
+
+            for (const auto& name : selected) {
+                const MultiplyKernel& kernel = backends.at(name);
+                if (!fails(kernel, fuzzCase, C)) {
+                    continue;
+                }
+                ++failures;
+                FuzzCase minimal = shrink(kernel, fuzzCase);
+                Matrix expected(minimal.rowsA, std::vector<int>(minimal.colsB, 0));
+                multiplyMatricesWithoutErrors(minimal.A, minimal.B, expected, minimal.rowsA, minimal.colsA, minimal.colsB);
+                fails(kernel, minimal, C);
+
+                std::lock_guard<std::mutex> lock(outputMutex);
+                std::cerr << "FAILURE backend: " << name << ", seed: " << seed << ", case: " << index
+                          << " (replay with --backend=" << name << " --seed=" << seed << " --first=" << index
+                          << " --iterations=1 --max-size=" << maxSize << ")" << std::endl;
+                std::cerr << "Original sizes " << fuzzCase.rowsA << "x" << fuzzCase.colsA << "x" << fuzzCase.colsB
+                          << ", minimal reproducer " << minimal.rowsA << "x" << minimal.colsA << "x" << minimal.colsB
+                          << ":" << std::endl;
+                printMatrix(std::cerr, "A", minimal.A);
+                printMatrix(std::cerr, "B", minimal.B);
+                printMatrix(std::cerr, "expected", expected);
+                printMatrix(std::cerr, "got", C);
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back(worker);
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    stopServers();
+
+    std::cout << failures << " failures" << std::endl;
+    MPI_Finalize();
+    return failures > 0 ? 1 : 0;
+}
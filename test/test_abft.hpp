@@ -0,0 +1,182 @@
+#ifndef TEST_ABFT_HPP
+#define TEST_ABFT_HPP
+
+/**
+ * @file test_abft.hpp
+ * @brief Test cases that verify the checksum-based (ABFT) detection and correction of silent errors.
+ *
+ * Faults are injected by wrapping the trusted kernel in a lambda that corrupts entries of the
+ * checksum-augmented product before it is verified.
+ */
+
+#include <vector>
+#include <gtest/gtest.h>
+#include "matrix_multiplication_abft.hpp"
+#include "matrix_multiplication_trusted.hpp"
+#include "test_distributed.hpp"
+
+namespace {
+
+const std::vector<std::vector<int>> abftA = {
+    {1, 2, 3},
+    {4, 5, 6},
+    {7, 8, 9},
+    {-1, 0, 2}
+};
+
+const std::vector<std::vector<int>> abftB = {
+    {2, 0},
+    {1, 3},
+    {-4, 5}
+};
+
+/**
+ * @brief Returns a kernel that computes the trusted product and then adds delta to the listed entries.
+ */
+MultiplyKernel faultyKernel(std::vector<std::pair<int, int>> faults, int delta) {
+    return [faults, delta](const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B,
+                           std::vector<std::vector<int>>& C, int rowsA, int colsA, int colsB) {
+        multiplyMatricesWithoutErrors(A, B, C, rowsA, colsA, colsB);
+        for (const auto& fault : faults) {
+            C[fault.first][fault.second] += delta;
+        }
+    };
+}
+
+} // namespace
+
+/**
+ * @brief Tests that a correct product passes the checksum verification untouched.
+ */
+TEST(AbftTests, CorrectProduct_ExpectedNoDetection) {
+    std::vector<std::vector<int>> C(4, std::vector<int>(2, 0));
+    std::vector<std::vector<int>> expected(4, std::vector<int>(2, 0));
+    multiplyMatricesWithoutErrors(abftA, abftB, expected, 4, 3, 2);
+
+    AbftReport report = multiplyMatricesABFT(abftA, abftB, C, 4, 3, 2, multiplyMatricesWithoutErrors);
+
+    EXPECT_FALSE(report.errorDetected);
+    EXPECT_EQ(C, expected);
+}
+
+/**
+ * @brief Tests the library function under checksum protection: the result is either correct or flagged
+ * as uncorrectable, it is never silently wrong.
+ */
+TEST(AbftTests, LibraryKernel_ExpectedTrustedProduct) {
+    std::vector<std::vector<int>> C(4, std::vector<int>(2, 0));
+    std::vector<std::vector<int>> expected(4, std::vector<int>(2, 0));
+    multiplyMatricesWithoutErrors(abftA, abftB, expected, 4, 3, 2);
+
+    AbftReport report = multiplyMatricesABFT(abftA, abftB, C, 4, 3, 2);
+
+    EXPECT_TRUE(C == expected || (report.errorDetected && !report.errorCorrected))
+        << "ABFT let a wrong product through without flagging it";
+}
+
+/**
+ * @brief Tests that a single wrong entry of the product is located and corrected.
+ */
+TEST(AbftTests, SingleFault_ExpectedCorrected) {
+    std::vector<std::vector<int>> C(4, std::vector<int>(2, 0));
+    std::vector<std::vector<int>> expected(4, std::vector<int>(2, 0));
+    multiplyMatricesWithoutErrors(abftA, abftB, expected, 4, 3, 2);
+
+    AbftReport report = multiplyMatricesABFT(abftA, abftB, C, 4, 3, 2, faultyKernel({{2, 1}}, 17));
+
+    EXPECT_TRUE(report.errorDetected);
+    EXPECT_TRUE(report.errorCorrected);
+    EXPECT_EQ(report.faultyRow, 2);
+    EXPECT_EQ(report.faultyCol, 1);
+    EXPECT_EQ(C, expected);
+}
+
+/**
+ * @brief Tests that a wrong checksum entry is detected and leaves the result intact.
+ */
+TEST(AbftTests, ChecksumFault_ExpectedResultIntact) {
+    std::vector<std::vector<int>> C(4, std::vector<int>(2, 0));
+    std::vector<std::vector<int>> expected(4, std::vector<int>(2, 0));
+    multiplyMatricesWithoutErrors(abftA, abftB, expected, 4, 3, 2);
+
+    // Row 4 is the checksum row of the augmented 5x3 product.
+    AbftReport report = multiplyMatricesABFT(abftA, abftB, C, 4, 3, 2, faultyKernel({{4, 0}}, -3));
+
+    EXPECT_TRUE(report.errorDetected);
+    EXPECT_TRUE(report.errorCorrected);
+    EXPECT_EQ(report.faultyRow, -1);
+    EXPECT_EQ(C, expected);
+}
+
+/**
+ * @brief Tests that two wrong entries in different rows and columns are detected but not corrected.
+ */
+TEST(AbftTests, DoubleFault_ExpectedUncorrectable) {
+    std::vector<std::vector<int>> C(4, std::vector<int>(2, 0));
+
+    AbftReport report = multiplyMatricesABFT(abftA, abftB, C, 4, 3, 2, faultyKernel({{0, 0}, {3, 1}}, 5));
+
+    EXPECT_TRUE(report.errorDetected);
+    EXPECT_FALSE(report.errorCorrected);
+    EXPECT_EQ(report.mismatchedRows, 2);
+    EXPECT_EQ(report.mismatchedCols, 2);
+}
+
+/**
+ * @brief Tests that two wrong entries cancelling out within a row, which leave every row checksum
+ * intact, are detected but not taken for a checksum fault.
+ */
+TEST(AbftTests, CancellingFaultsInRow_ExpectedUncorrectable) {
+    std::vector<std::vector<int>> C(4, std::vector<int>(2, 0));
+    MultiplyKernel kernel = [](const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B,
+                               std::vector<std::vector<int>>& C, int rowsA, int colsA, int colsB) {
+        multiplyMatricesWithoutErrors(A, B, C, rowsA, colsA, colsB);
+        C[0][0] += 5;
+        C[0][1] -= 5;
+    };
+
+    AbftReport report = multiplyMatricesABFT(abftA, abftB, C, 4, 3, 2, kernel);
+
+    EXPECT_TRUE(report.errorDetected);
+    EXPECT_FALSE(report.errorCorrected);
+    EXPECT_EQ(report.mismatchedRows, 0);
+    EXPECT_EQ(report.mismatchedCols, 2);
+}
+
+/**
+ * @brief Tests that a data fault masked by a fault of its row checksum is not taken for a checksum fault.
+ */
+TEST(AbftTests, MaskedDataFault_ExpectedUncorrectable) {
+    std::vector<std::vector<int>> C(4, std::vector<int>(2, 0));
+
+    // Column 2 is the checksum column of the augmented 5x3 product.
+    AbftReport report = multiplyMatricesABFT(abftA, abftB, C, 4, 3, 2, faultyKernel({{1, 0}, {1, 2}}, 4));
+
+    EXPECT_TRUE(report.errorDetected);
+    EXPECT_FALSE(report.errorCorrected);
+}
+
+/**
+ * @brief Tests the collective ABFT product: every rank joins the augmented distributed product and the
+ * root gets the verified result.
+ */
+TEST(AbftTests, Distributed_ExpectedTrustedProduct) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    const int rowsA = 37, colsA = 23, colsB = 41;
+    auto A = randomDistributedInput(rowsA, colsA, 52);
+    auto B = randomDistributedInput(colsA, colsB, 53);
+    std::vector<std::vector<int>> C(rowsA, std::vector<int>(colsB, 0));
+    std::vector<std::vector<int>> expected(rowsA, std::vector<int>(colsB, 0));
+
+    AbftReport report = multiplyMatricesABFTDistributed(A, B, C, rowsA, colsA, colsB, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        multiplyMatricesWithoutErrors(A, B, expected, rowsA, colsA, colsB);
+        EXPECT_FALSE(report.errorDetected);
+        EXPECT_EQ(C, expected);
+    }
+}
+
+#endif // TEST_ABFT_HPP
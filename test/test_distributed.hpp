@@ -0,0 +1,88 @@
+#ifndef TEST_DISTRIBUTED_HPP
+#define TEST_DISTRIBUTED_HPP
+
+/**
+ * @file test_distributed.hpp
+ * @brief Test cases that verify the topology-aware distributed multiplication against the trusted product.
+ *
+ * The tests are collective over MPI_COMM_WORLD: they run with a single process when launched by ctest
+ * and can be launched with mpirun to exercise the node-local and inter-node splits. The result is only
+ * checked on rank 0, which is the only rank that receives C.
+ */
+
+#include <string>
+#include <vector>
+#include <random>
+#include <mpi.h>
+#include <gtest/gtest.h>
+#include "matrix_multiplication_distributed.hpp"
+#include "matrix_multiplication_trusted.hpp"
+
+/**
+ * @brief Fills a matrix with values uniformly distributed in [-100, 100]. A fixed seed keeps
+ * every rank in agreement on the inputs.
+ */
+inline std::vector<std::vector<int>> randomDistributedInput(int rows, int cols, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<> dis(-100, 100);
+    std::vector<std::vector<int>> M(rows, std::vector<int>(cols));
+    for (auto& row : M)
+        for (auto& elem : row)
+            elem = dis(gen);
+    return M;
+}
+
+/**
+ * @brief Name of a scratch file private to the calling rank, so that tests launched with mpirun do not
+ * race on the same file.
+ */
+inline std::string rankFileName(const std::string& base) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    return "rank" + std::to_string(rank) + "_" + base;
+}
+
+/**
+ * @brief Tests the distributed product of rectangular matrices whose sizes are not multiples
+ * of the number of processes, so that bands and panels have uneven sizes.
+ */
+TEST(DistributedTests, RectangularMatrices_ExpectedTrustedProduct) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    const int rowsA = 37, colsA = 23, colsB = 41;
+    auto A = randomDistributedInput(rowsA, colsA, 42);
+    auto B = randomDistributedInput(colsA, colsB, 43);
+    std::vector<std::vector<int>> C(rowsA, std::vector<int>(colsB, 0));
+    std::vector<std::vector<int>> expected(rowsA, std::vector<int>(colsB, 0));
+
+    multiplyMatricesDistributed(A, B, C, rowsA, colsA, colsB, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        multiplyMatricesWithoutErrors(A, B, expected, rowsA, colsA, colsB);
+        EXPECT_EQ(C, expected) << "The distributed product differs from the trusted product";
+    }
+}
+
+/**
+ * @brief Tests the distributed product when there are fewer rows and columns than processes,
+ * so that some bands and panels are empty.
+ * @note The inner size is 5 so that the product has no fixed-size specialization and goes through
+ * the shared windows.
+ */
+TEST(DistributedTests, TinyMatrices_ExpectedTrustedProduct) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    std::vector<std::vector<int>> A = {{1, 2, 3, 4, 5}};
+    std::vector<std::vector<int>> B = {{6}, {7}, {8}, {9}, {10}};
+    std::vector<std::vector<int>> C(1, std::vector<int>(1, 0));
+
+    multiplyMatricesDistributed(A, B, C, 1, 5, 1, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        EXPECT_EQ(C[0][0], 130);
+    }
+}
+
+#endif // TEST_DISTRIBUTED_HPP
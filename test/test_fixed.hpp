@@ -0,0 +1,78 @@
+#ifndef TEST_FIXED_HPP
+#define TEST_FIXED_HPP
+
+/**
+ * @file test_fixed.hpp
+ * @brief Test cases that verify the compile-time specialized kernels and their runtime dispatcher.
+ */
+
+#include <vector>
+#include <random>
+#include <gtest/gtest.h>
+#include "matrix_multiplication_fixed.hpp"
+#include "matrix_multiplication_trusted.hpp"
+
+// The specializations are constexpr: a 2x2 product is checked at compile time.
+constexpr FixedMatrix<2, 2> fixedProduct2x2 =
+    multiply<2, 2, 2>(FixedMatrix<2, 2>{{{1, 2}, {3, 4}}}, FixedMatrix<2, 2>{{{5, 6}, {7, 8}}});
+static_assert(fixedProduct2x2[0][0] == 19 && fixedProduct2x2[0][1] == 22 &&
+              fixedProduct2x2[1][0] == 43 && fixedProduct2x2[1][1] == 50,
+              "multiply<2,2,2> is wrong");
+
+/**
+ * @brief Tests a rectangular compile-time product against the known result.
+ */
+TEST(FixedTests, RectangularProduct_ExpectedKnownResult) {
+    FixedMatrix<2, 3> A = {{{1, 2, 3}, {4, 5, 6}}};
+    FixedMatrix<3, 2> B = {{{7, 8}, {9, 10}, {11, 12}}};
+    FixedMatrix<2, 2> expected = {{{58, 64}, {139, 154}}};
+
+    EXPECT_EQ((multiply<2, 3, 2>(A, B)), expected);
+}
+
+/**
+ * @brief Tests that the dispatcher handles every specialized shape and agrees with the trusted product.
+ * @note Shapes with all sizes up to maxFixedShapeSize and square shapes up to maxFixedSquareSize are covered.
+ */
+TEST(FixedTests, DispatcherAllSpecializedShapes_ExpectedTrustedProduct) {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<> dis(-100, 100);
+
+    for (int rowsA = 1; rowsA <= maxFixedSquareSize; ++rowsA) {
+        for (int colsA = 1; colsA <= maxFixedSquareSize; ++colsA) {
+            for (int colsB = 1; colsB <= maxFixedSquareSize; ++colsB) {
+                if (!hasFixedSpecialization(rowsA, colsA, colsB)) {
+                    continue;
+                }
+                std::vector<std::vector<int>> A(rowsA, std::vector<int>(colsA));
+                std::vector<std::vector<int>> B(colsA, std::vector<int>(colsB));
+                std::vector<std::vector<int>> C(rowsA, std::vector<int>(colsB, 0));
+                std::vector<std::vector<int>> expected(rowsA, std::vector<int>(colsB, 0));
+                for (auto& row : A)
+                    for (auto& elem : row)
+                        elem = dis(gen);
+                for (auto& row : B)
+                    for (auto& elem : row)
+                        elem = dis(gen);
+
+                ASSERT_TRUE(multiplyMatricesFixed(A, B, C, rowsA, colsA, colsB));
+                multiplyMatricesWithoutErrors(A, B, expected, rowsA, colsA, colsB);
+                EXPECT_EQ(C, expected) << "Sizes " << rowsA << "x" << colsA << "x" << colsB;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Tests that sizes without a specialization are rejected and leave C untouched.
+ */
+TEST(FixedTests, DispatcherUnspecializedShape_ExpectedRejected) {
+    std::vector<std::vector<int>> A(5, std::vector<int>(3, 1));
+    std::vector<std::vector<int>> B(3, std::vector<int>(2, 1));
+    std::vector<std::vector<int>> C(5, std::vector<int>(2, -1));
+
+    EXPECT_FALSE(multiplyMatricesFixed(A, B, C, 5, 3, 2));
+    EXPECT_EQ(C, std::vector<std::vector<int>>(5, std::vector<int>(2, -1)));
+}
+
+#endif // TEST_FIXED_HPP
@@ -0,0 +1,172 @@
+#ifndef TEST_INCREMENTAL_HPP
+#define TEST_INCREMENTAL_HPP
+
+/**
+ * @file test_incremental.hpp
+ * @brief Test cases that verify the incremental update of C and the binary product state it relies on.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include <random>
+#include <gtest/gtest.h>
+#include "matrix_incremental.hpp"
+#include "matrix_multiplication_trusted.hpp"
+#include "test_distributed.hpp"
+
+namespace {
+
+/**
+ * @brief Random state of the given sizes with C computed by the trusted function.
+ */
+ProductState randomProductState(int rowsA, int colsA, int colsB, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<> dis(-100, 100);
+    ProductState state;
+    state.rowsA = rowsA;
+    state.colsA = colsA;
+    state.colsB = colsB;
+    state.A.assign(rowsA, std::vector<int>(colsA));
+    state.B.assign(colsA, std::vector<int>(colsB));
+    state.C.assign(rowsA, std::vector<int>(colsB, 0));
+    for (auto& row : state.A)
+        for (auto& elem : row)
+            elem = dis(gen);
+    for (auto& row : state.B)
+        for (auto& elem : row)
+            elem = dis(gen);
+    multiplyMatricesWithoutErrors(state.A, state.B, state.C, rowsA, colsA, colsB);
+    return state;
+}
+
+} // namespace
+
+/**
+ * @brief Tests that editing a few rows of A and columns of B yields the trusted product.
+ */
+TEST(IncrementalTests, FewChanges_ExpectedTrustedProduct) {
+    const int rowsA = 30, colsA = 25, colsB = 20;
+    ProductState previous = randomProductState(rowsA, colsA, colsB, 11);
+
+    auto A = previous.A;
+    auto B = previous.B;
+    for (int k = 0; k < colsA; ++k) {
+        A[3][k] += k - 7;
+        B[k][12] = 5 * k;
+    }
+    A[17][0] = -42;
+    B[24][1] = 99;
+
+    std::vector<std::vector<int>> C(rowsA, std::vector<int>(colsB, 0));
+    std::vector<std::vector<int>> expected(rowsA, std::vector<int>(colsB, 0));
+    multiplyMatricesWithoutErrors(A, B, expected, rowsA, colsA, colsB);
+
+    ASSERT_TRUE(updateProductIncremental(previous, A, B, C, rowsA, colsA, colsB));
+    EXPECT_EQ(C, expected);
+}
+
+/**
+ * @brief Tests that unchanged inputs give back the previous product.
+ */
+TEST(IncrementalTests, NoChanges_ExpectedPreviousProduct) {
+    ProductState previous = randomProductState(8, 9, 10, 12);
+    std::vector<std::vector<int>> C(8, std::vector<int>(10, 0));
+
+    ASSERT_TRUE(updateProductIncremental(previous, previous.A, previous.B, C, 8, 9, 10));
+    EXPECT_EQ(C, previous.C);
+}
+
+/**
+ * @brief Tests that different sizes or too many changes fall back to a full multiplication,
+ * leaving C untouched.
+ */
+TEST(IncrementalTests, LargeChanges_ExpectedFallback) {
+    ProductState previous = randomProductState(10, 10, 10, 13);
+    std::vector<std::vector<int>> C(10, std::vector<int>(10, -1));
+    const std::vector<std::vector<int>> untouched = C;
+
+    ProductState other = randomProductState(10, 10, 10, 14);
+    EXPECT_FALSE(updateProductIncremental(previous, other.A, other.B, C, 10, 10, 10));
+    EXPECT_EQ(C, untouched);
+
+    ProductState larger = randomProductState(11, 10, 10, 13);
+    EXPECT_FALSE(updateProductIncremental(previous, larger.A, larger.B, C, 11, 10, 10));
+    EXPECT_EQ(C, untouched);
+}
+
+/**
+ * @brief Tests that the product state survives a round trip through the binary file,
+ * and that a file which is not a product state is rejected.
+ */
+TEST(IncrementalTests, SaveAndLoad_ExpectedSameState) {
+    ProductState state = randomProductState(5, 3, 4, 15);
+    const std::string filename = rankFileName("test_incremental_state.bin");
+
+    ASSERT_TRUE(saveProductState(filename, state));
+    ProductState loaded;
+    ASSERT_TRUE(loadProductState(filename, loaded));
+    EXPECT_EQ(loaded.rowsA, 5);
+    EXPECT_EQ(loaded.colsA, 3);
+    EXPECT_EQ(loaded.colsB, 4);
+    EXPECT_EQ(loaded.A, state.A);
+    EXPECT_EQ(loaded.B, state.B);
+    EXPECT_EQ(loaded.C, state.C);
+
+    std::FILE* file = std::fopen(filename.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    std::fputs("3 3\n1 2 3\n", file);
+    std::fclose(file);
+    EXPECT_FALSE(loadProductState(filename, loaded));
+    std::remove(filename.c_str());
+}
+
+/**
+ * @brief Tests that a state whose header announces sizes that do not match the length of the file is
+ * rejected instead of driving a huge allocation.
+ */
+TEST(IncrementalTests, DamagedSizes_ExpectedRejected) {
+    ProductState state = randomProductState(5, 3, 4, 16);
+    const std::string filename = rankFileName("test_incremental_damaged.bin");
+    ASSERT_TRUE(saveProductState(filename, state));
+
+    // Overwrite rowsA, right after the magic, with a huge value.
+    std::FILE* file = std::fopen(filename.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    int32_t hugeRows = 2000000000;
+    std::fseek(file, 4, SEEK_SET);
+    std::fwrite(&hugeRows, sizeof(hugeRows), 1, file);
+    std::fclose(file);
+
+    ProductState loaded;
+    EXPECT_FALSE(loadProductState(filename, loaded));
+
+    // A truncated file is rejected as well.
+    ASSERT_TRUE(saveProductState(filename, state));
+    file = std::fopen(filename.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    std::fseek(file, 0, SEEK_END);
+    long length = std::ftell(file);
+    std::rewind(file);
+    std::vector<char> bytes(length - 4);
+    std::fread(bytes.data(), 1, bytes.size(), file);
+    std::fclose(file);
+    file = std::fopen(filename.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    std::fwrite(bytes.data(), 1, bytes.size(), file);
+    std::fclose(file);
+    EXPECT_FALSE(loadProductState(filename, loaded));
+
+    // Sizes whose byte count wraps to exactly 2^64 in 64-bit arithmetic, in a file holding only the header.
+    file = std::fopen(filename.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    int32_t wrappingSizes[3] = {1610612736, 1073741824, 1073741824};
+    std::fwrite("MMST", 1, 4, file);
+    std::fwrite(wrappingSizes, sizeof(int32_t), 3, file);
+    std::fclose(file);
+    EXPECT_FALSE(loadProductState(filename, loaded));
+
+    std::remove(filename.c_str());
+}
+
+#endif // TEST_INCREMENTAL_HPP
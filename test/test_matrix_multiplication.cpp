@@ -2,15 +2,26 @@
 #include <iostream>
 #include <vector>
 #include <gtest/gtest.h>
+#include <mpi.h>
 
+#include "test_abft.hpp"
 #include "test_algebraic.hpp"
 #include "test_combinatorial.hpp"
+#include "test_distributed.hpp"
+#include "test_fixed.hpp"
+#include "test_incremental.hpp"
 #include "test_monkey.hpp"
+#include "test_overflow.hpp"
 #include "test_structural.hpp"
+#include "test_tuning.hpp"
+#include "test_verification.hpp"
 
 
 int main(int argc, char **argv) {
+    MPI_Init(&argc, &argv);
     testing::InitGoogleTest(&argc, argv);
     std::cout << "Running 'em all!" << std::endl;
-    return RUN_ALL_TESTS();
+    int result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
 }
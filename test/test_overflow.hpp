@@ -0,0 +1,123 @@
+#ifndef TEST_OVERFLOW_HPP
+#define TEST_OVERFLOW_HPP
+
+/**
+ * @file test_overflow.hpp
+ * @brief Test cases that verify the overflow-safe multiplications: widened int64 results, saturation
+ * and flagging of the entries that do not fit in int.
+ */
+
+#include <climits>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+#include "matrix_multiplication_safe.hpp"
+#include "matrix_multiplication_trusted.hpp"
+
+namespace {
+
+// C[0][0] = 2 * INT_MAX overflows upwards, C[0][1] = -2 * INT_MAX downwards, C[1][*] fit in int.
+const std::vector<std::vector<int>> overflowA = {
+    {INT_MAX, INT_MAX},
+    {1, 2}
+};
+
+const std::vector<std::vector<int>> overflowB = {
+    {1, -1},
+    {1, -1}
+};
+
+} // namespace
+
+/**
+ * @brief Tests that the widened product holds the exact results of entries that overflow int.
+ */
+TEST(OverflowTests, Widened_ExpectedExactResults) {
+    std::vector<std::vector<int64_t>> C(2, std::vector<int64_t>(2, 0));
+
+    int overflows = multiplyMatricesWidened(overflowA, overflowB, C, 2, 2, 2);
+
+    EXPECT_EQ(overflows, 0);
+    EXPECT_EQ(C[0][0], 2LL * INT_MAX);
+    EXPECT_EQ(C[0][1], -2LL * INT_MAX);
+    EXPECT_EQ(C[1][0], 3);
+    EXPECT_EQ(C[1][1], -3);
+}
+
+/**
+ * @brief Tests that entries overflowing even int64 are computed exactly before being saturated.
+ * @note INT_MIN * INT_MIN = 2^62 and INT_MIN * INT_MAX = -2^62 + 2^31.
+ */
+TEST(OverflowTests, WidenedBeyondInt64_ExpectedSaturated) {
+    std::vector<std::vector<int>> A = {{INT_MIN, INT_MIN, INT_MIN, INT_MIN, 0}};
+    std::vector<std::vector<int>> B = {{INT_MIN}, {INT_MIN}, {INT_MIN}, {INT_MIN}, {1}};
+    std::vector<std::vector<int64_t>> C(1, std::vector<int64_t>(1, 0));
+
+    EXPECT_EQ(multiplyMatricesWidened(A, B, C, 1, 5, 1), 1);
+    EXPECT_EQ(C[0][0], INT64_MAX);
+
+    // The running sum overflows int64 after two terms, the last two terms bring it back: 2^32.
+    A = {{INT_MIN, INT_MIN, INT_MIN, INT_MIN}};
+    B = {{INT_MIN}, {INT_MIN}, {INT_MAX}, {INT_MAX}};
+    EXPECT_EQ(multiplyMatricesWidened(A, B, C, 1, 4, 1), 0);
+    EXPECT_EQ(C[0][0], int64_t(1) << 32);
+}
+
+/**
+ * @brief Tests that the saturating product clamps the overflowing entries and leaves the others exact.
+ */
+TEST(OverflowTests, Saturating_ExpectedClampedEntries) {
+    std::vector<std::vector<int>> C(2, std::vector<int>(2, 0));
+
+    int overflows = multiplyMatricesSaturating(overflowA, overflowB, C, 2, 2, 2);
+
+    EXPECT_EQ(overflows, 2);
+    EXPECT_EQ(C[0][0], INT_MAX);
+    EXPECT_EQ(C[0][1], INT_MIN);
+    EXPECT_EQ(C[1][0], 3);
+    EXPECT_EQ(C[1][1], -3);
+}
+
+/**
+ * @brief Tests that the flagging product marks exactly the overflowing entries.
+ */
+TEST(OverflowTests, Flagged_ExpectedFlaggedEntries) {
+    std::vector<std::vector<int>> C(2, std::vector<int>(2, 0));
+    std::vector<std::vector<bool>> overflowed;
+
+    int overflows = multiplyMatricesFlagged(overflowA, overflowB, C, overflowed, 2, 2, 2);
+
+    EXPECT_EQ(overflows, 2);
+    EXPECT_EQ(overflowed, (std::vector<std::vector<bool>>{{true, true}, {false, false}}));
+    EXPECT_EQ(C[0][0], -2);
+    EXPECT_EQ(C[0][1], 2);
+    EXPECT_EQ(C[1][0], 3);
+}
+
+/**
+ * @brief Tests that without overflow the safe products agree with the trusted product.
+ */
+TEST(OverflowTests, NoOverflow_ExpectedTrustedProduct) {
+    std::vector<std::vector<int>> A = {
+        {1, -2, 3},
+        {4, 5, -6}
+    };
+
+    std::vector<std::vector<int>> B = {
+        {7, 8},
+        {-9, 10},
+        {11, 12}
+    };
+
+    std::vector<std::vector<int>> expected(2, std::vector<int>(2, 0));
+    std::vector<std::vector<int>> C(2, std::vector<int>(2, 0));
+    std::vector<std::vector<bool>> overflowed;
+    multiplyMatricesWithoutErrors(A, B, expected, 2, 3, 2);
+
+    EXPECT_EQ(multiplyMatricesSaturating(A, B, C, 2, 3, 2), 0);
+    EXPECT_EQ(C, expected);
+    EXPECT_EQ(multiplyMatricesFlagged(A, B, C, overflowed, 2, 3, 2), 0);
+    EXPECT_EQ(C, expected);
+}
+
+#endif // TEST_OVERFLOW_HPP
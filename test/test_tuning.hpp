@@ -0,0 +1,125 @@
+#ifndef TEST_TUNING_HPP
+#define TEST_TUNING_HPP
+
+/**
+ * @file test_tuning.hpp
+ * @brief Test cases that verify the tuning file, the selection of the parameters and that every tuned
+ * configuration of the distributed multiplication computes the same product.
+ */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <mpi.h>
+#include <gtest/gtest.h>
+#include "matrix_multiplication_distributed.hpp"
+#include "matrix_multiplication_trusted.hpp"
+#include "matrix_tuning.hpp"
+#include "test_distributed.hpp"
+
+/**
+ * @brief Tests that a tuning table survives a round trip through the tuning file.
+ */
+TEST(TuningTests, SaveAndLoad_ExpectedSameTable) {
+    TuningParameters small;
+    small.maxSize = 64;
+    small.kernel = PanelKernel::Naive;
+    TuningParameters large;
+    large.maxSize = 512;
+    large.tileRows = 16;
+    large.tileInner = 64;
+    large.tileCols = 512;
+    large.threads = 4;
+    large.gridRows = 2;
+
+    const std::string filename = rankFileName("test_tuning_roundtrip.txt");
+    ASSERT_TRUE(saveTuningFile(filename, {large, small}));
+    std::vector<TuningParameters> table = loadTuningFile(filename);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(table.size(), 2u);
+    EXPECT_EQ(table[0].maxSize, 64);
+    EXPECT_EQ(table[0].kernel, PanelKernel::Naive);
+    EXPECT_EQ(table[1].maxSize, 512);
+    EXPECT_EQ(table[1].kernel, PanelKernel::Blocked);
+    EXPECT_EQ(table[1].tileRows, 16);
+    EXPECT_EQ(table[1].tileInner, 64);
+    EXPECT_EQ(table[1].tileCols, 512);
+    EXPECT_EQ(table[1].threads, 4);
+    EXPECT_EQ(table[1].gridRows, 2);
+}
+
+/**
+ * @brief Tests that lines with an unknown kernel or non-positive parameters are skipped.
+ */
+TEST(TuningTests, MalformedLines_ExpectedSkipped) {
+    const std::string filename = rankFileName("test_tuning_malformed.txt");
+    std::FILE* file = std::fopen(filename.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    std::fputs("# maxSize kernel tileRows tileInner tileCols threads gridRows\n"
+               "64 blokced 32 128 256 1 1\n"
+               "128 naive 0 128 256 1 1\n"
+               "256 blocked 32 128 256 -2 1\n"
+               "512 blocked 32 128 256 2 0\n"
+               "768 naive 16 64 128 2 1\n", file);
+    std::fclose(file);
+    std::vector<TuningParameters> table = loadTuningFile(filename);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(table.size(), 1u);
+    EXPECT_EQ(table[0].maxSize, 768);
+    EXPECT_EQ(table[0].kernel, PanelKernel::Naive);
+}
+
+/**
+ * @brief Tests that the smallest class containing the product is selected, and the largest class
+ * for products bigger than every class.
+ */
+TEST(TuningTests, Selection_ExpectedSmallestContainingClass) {
+    std::vector<TuningParameters> table(3);
+    table[0].maxSize = 64;
+    table[1].maxSize = 256;
+    table[2].maxSize = 768;
+
+    EXPECT_EQ(selectTuning(table, 10, 64, 3).maxSize, 64);
+    EXPECT_EQ(selectTuning(table, 65, 2, 2).maxSize, 256);
+    EXPECT_EQ(selectTuning(table, 2000, 2000, 2000).maxSize, 768);
+    EXPECT_EQ(selectTuning({}, 10, 10, 10).maxSize, 0);
+}
+
+/**
+ * @brief Tests that kernels, uneven tiles, threads and local grid shapes all yield the trusted product.
+ */
+TEST(TuningTests, AllConfigurations_ExpectedTrustedProduct) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    const int rowsA = 45, colsA = 38, colsB = 51;
+    auto A = randomDistributedInput(rowsA, colsA, 5);
+    auto B = randomDistributedInput(colsA, colsB, 6);
+    std::vector<std::vector<int>> expected(rowsA, std::vector<int>(colsB, 0));
+    multiplyMatricesWithoutErrors(A, B, expected, rowsA, colsA, colsB);
+
+    std::vector<TuningParameters> configurations(5);
+    configurations[0].kernel = PanelKernel::Naive;
+    configurations[1].tileRows = 7;
+    configurations[1].tileInner = 5;
+    configurations[1].tileCols = 9;
+    configurations[2].threads = 3;
+    configurations[3].tileRows = 4;
+    configurations[3].threads = 2;
+    configurations[3].gridRows = 2;
+    configurations[4].kernel = PanelKernel::Naive;
+    configurations[4].gridRows = 3;
+
+    for (const auto& params : configurations) {
+        std::vector<std::vector<int>> C(rowsA, std::vector<int>(colsB, 0));
+        multiplyMatricesDistributed(A, B, C, rowsA, colsA, colsB, MPI_COMM_WORLD, params);
+        if (rank == 0) {
+            EXPECT_EQ(C, expected) << "Tiles " << params.tileRows << "x" << params.tileInner << "x" << params.tileCols
+                                   << ", threads " << params.threads << ", grid rows " << params.gridRows;
+        }
+    }
+}
+
+#endif // TEST_TUNING_HPP
@@ -0,0 +1,103 @@
+#ifndef TEST_VERIFICATION_HPP
+#define TEST_VERIFICATION_HPP
+
+/**
+ * @file test_verification.hpp
+ * @brief Test cases that validate products with Freivalds' randomized check instead of recomputing
+ * them with the O(n^3) trusted function, which makes production-sized inputs affordable.
+ *
+ * If a test fails, it prints the seed used to generate the matrices in order for the test to be REPRODUCIBLE.
+ */
+
+#include <vector>
+#include <random>
+#include <mpi.h>
+#include <gtest/gtest.h>
+#include "matrix_multiplication.h"
+#include "matrix_verification.hpp"
+
+/**
+ * @brief Random large product of the library function, verified in quadratic time.
+ * @note Values are in [-100, 100], the sizes are picked randomly between 100 and 300.
+ */
+TEST(VerificationTests, LargeRandomProduct_ExpectedVerified) {
+    std::random_device rd;
+    auto seed = rd();
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<> size(100, 300);
+    std::uniform_int_distribution<> dis(-100, 100);
+
+    int rowA = size(gen);
+    int colA = size(gen);
+    int colB = size(gen);
+
+    std::vector<std::vector<int>> A(rowA, std::vector<int>(colA));
+    std::vector<std::vector<int>> B(colA, std::vector<int>(colB));
+    std::vector<std::vector<int>> C(rowA, std::vector<int>(colB));
+
+    for (auto& row : A)
+        for (auto& elem : row)
+            elem = dis(gen);
+
+    for (auto& row : B)
+        for (auto& elem : row)
+            elem = dis(gen);
+
+    multiplyMatrices(A, B, C, rowA, colA, colB);
+
+    EXPECT_TRUE(verifyProductFreivalds(A, B, C, rowA, colA, colB, 20, seed))
+        << "Matrix multiplication verification failed! Seed: " << seed;
+}
+
+/**
+ * @brief A single wrong entry must be caught.
+ * @note With 30 random vectors a wrong product is accepted with probability at most 2^-30,
+ * and the fixed seed makes the outcome deterministic.
+ */
+TEST(VerificationTests, CorruptedProduct_ExpectedRejected) {
+    std::vector<std::vector<int>> A = {
+        {1, 2, 3},
+        {4, 5, 6}
+    };
+
+    std::vector<std::vector<int>> B = {
+        {7, 8},
+        {9, 10},
+        {11, 12}
+    };
+
+    std::vector<std::vector<int>> C = {
+        {58, 64},
+        {139, 154}
+    };
+
+    ASSERT_TRUE(verifyProductFreivalds(A, B, C, 2, 3, 2, 30, 1234u));
+
+    C[1][0] += 1;
+    EXPECT_FALSE(verifyProductFreivalds(A, B, C, 2, 3, 2, 30, 1234u));
+}
+
+/**
+ * @brief The distributed check splits the random vectors among the ranks and agrees on the verdict.
+ * @note Run with mpirun to spread the vectors over several ranks.
+ */
+TEST(VerificationTests, DistributedCheck_ExpectedSameVerdictOnAllRanks) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    std::vector<std::vector<int>> A, B, C;
+    if (rank == 0) {
+        A = {{2, -1}, {0, 3}};
+        B = {{1, 4}, {5, -2}};
+        C = {{-3, 10}, {15, -6}};
+    }
+
+    EXPECT_TRUE(verifyProductFreivaldsDistributed(A, B, C, 2, 2, 2, 16, 99u, MPI_COMM_WORLD));
+
+    if (rank == 0) {
+        C[0][1] = 11;
+    }
+    EXPECT_FALSE(verifyProductFreivaldsDistributed(A, B, C, 2, 2, 2, 16, 99u, MPI_COMM_WORLD));
+}
+
+#endif // TEST_VERIFICATION_HPP